@@ -1281,6 +1281,7 @@ FHoudiniAssetComponentDetails::OnBakeStaticMesh( UStaticMesh * StaticMesh, UHoud
         // We need to locate corresponding geo part object in component.
         const FHoudiniGeoPartObject& HoudiniGeoPartObject = HoudiniAssetComponent->LocateGeoPartObject( StaticMesh );
 
+        FHoudiniScopedBakePackages ScopedBakePackages;
         (void) FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
             StaticMesh, HoudiniAssetComponent, HoudiniGeoPartObject, EBakeMode::ReplaceExisitingAssets );
     }
@@ -1341,6 +1342,7 @@ FHoudiniAssetComponentDetails::OnBakeAllGeneratedMeshes()
         if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
             return FReply::Handled();
 
+        FHoudiniScopedBakePackages ScopedBakePackages;
         for( TMap< FHoudiniGeoPartObject, UStaticMesh * >::TIterator
             Iter(HoudiniAssetComponent->StaticMeshes); Iter; ++Iter )
         {
@@ -992,7 +992,8 @@ FHoudiniEngineEditor::BakeAllAssets()
     FString Notification = TEXT("Baking all assets in the current level...");
     FHoudiniEngineUtils::CreateSlateNotification( Notification );
 
-    // Bakes and replaces with blueprints all Houdini Assets in the current level
+    // Bakes and replaces with blueprints all Houdini Assets in the current level, their packages are saved together.
+    FHoudiniScopedBakePackages ScopedBakePackages;
     int32 BakedCount = 0;
     for (TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr)
     {
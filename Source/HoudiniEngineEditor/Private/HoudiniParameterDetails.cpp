@@ -470,10 +470,49 @@ FHoudiniParameterDetails::CreateWidgetMultiparm( IDetailCategoryBuilder & LocalD
     Row.ValueWidget.Widget = HorizontalBox;
     Row.ValueWidget.MinDesiredWidth( HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH );
 
-    // Recursively create all child parameters.
+    // Long multiparms only get widgets for their first instances, more are built on request.
+    int32 FirstInstanceIndex = MAX_int32;
     for ( UHoudiniAssetParameter * ChildParam : InParam.ChildParameters )
         if ( ChildParam && !ChildParam->IsPendingKill() )
-            FHoudiniParameterDetails::CreateWidget( LocalDetailCategoryBuilder, ChildParam );
+            FirstInstanceIndex = FMath::Min( FirstInstanceIndex, ChildParam->MultiparmInstanceIndex );
+
+    const int32 NumDisplayedInstances = FMath::Min( InParam.NumDisplayedInstances, InParam.MultiparmValue );
+
+    // Recursively create the child parameters of displayed instances.
+    for ( UHoudiniAssetParameter * ChildParam : InParam.ChildParameters )
+    {
+        if ( !ChildParam || ChildParam->IsPendingKill() )
+            continue;
+
+        if ( ChildParam->MultiparmInstanceIndex - FirstInstanceIndex >= NumDisplayedInstances )
+            continue;
+
+        FHoudiniParameterDetails::CreateWidget( LocalDetailCategoryBuilder, ChildParam );
+    }
+
+    if ( NumDisplayedInstances < InParam.MultiparmValue )
+    {
+        TWeakObjectPtr< UHoudiniAssetParameterMultiparm > MyParam( &InParam );
+        const FText ShowMoreText = FText::Format(
+            LOCTEXT( "ShowMoreMultiparmInstances", "Showing {0} of {1} instances, show more" ),
+            FText::AsNumber( NumDisplayedInstances ), FText::AsNumber( InParam.MultiparmValue ) );
+
+        LocalDetailCategoryBuilder.AddCustomRow( FText::GetEmpty() )
+        [
+            SNew( SButton )
+            .VAlign( VAlign_Center )
+            .HAlign( HAlign_Center )
+            .Text( ShowMoreText )
+            .OnClicked( FOnClicked::CreateLambda( [=]() {
+                if ( MyParam.IsValid() )
+                {
+                    MyParam->NumDisplayedInstances += HAPI_UNREAL_MULTIPARM_INSTANCES_PER_PAGE;
+                    MyParam->OnParamStateChanged();
+                }
+                return FReply::Handled();
+            }))
+        ];
+    }
 }
 
 /** We need to inherit from curve editor in order to get subscription to mouse events. **/
@@ -39,6 +39,7 @@
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Framework/Application/SlateApplication.h"
 #include "EditorStyleSet.h"
+#include "Containers/Ticker.h"
 
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "Internationalization/Internationalization.h"
@@ -89,6 +90,8 @@ FHoudiniSplineComponentVisualizer::FHoudiniSplineComponentVisualizer()
     , CachedRotation( FQuat::Identity )
     , bComponentNeedUpdate( false )
     , bCookOnlyOnMouseRelease( false )
+    , bPreviewCookWhileDragging( false )
+    , LastPreviewCookTime( 0.0 )
     , bRecordTransactionOnMove( true )
 {
     FHoudiniSplineComponentVisualizerCommands::Register();
@@ -97,6 +100,9 @@ FHoudiniSplineComponentVisualizer::FHoudiniSplineComponentVisualizer()
 
 FHoudiniSplineComponentVisualizer::~FHoudiniSplineComponentVisualizer()
 {
+    if ( PreviewCookTickerHandle.IsValid() )
+        FTicker::GetCoreTicker().RemoveTicker( PreviewCookTickerHandle );
+
     FHoudiniSplineComponentVisualizerCommands::Unregister();
 }
 
@@ -279,9 +285,13 @@ FHoudiniSplineComponentVisualizer::HandleInputKey(
 
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
     bCookOnlyOnMouseRelease = HoudiniRuntimeSettings->bCookCurvesOnMouseRelease;
+    bPreviewCookWhileDragging = HoudiniRuntimeSettings->bPreviewCurvesWhileDragging;
 
     if ( Key == EKeys::LeftMouseButton && Event == IE_Released )
     {
+        // Drop the pending preview, the full quality cook uses the latest points.
+        EndPreviewCook();
+
         // Updates the spline
         if ( bComponentNeedUpdate )
             UpdateHoudiniComponents();
@@ -314,6 +324,8 @@ FHoudiniSplineComponentVisualizer::HandleInputKey(
 void
 FHoudiniSplineComponentVisualizer::EndEditing()
 {
+    EndPreviewCook();
+
     EditedHoudiniSplineComponent = nullptr;
     EditedControlPointsIndexes.Empty();
 }
@@ -432,10 +444,19 @@ FHoudiniSplineComponentVisualizer::HandleInputDelta(
         NotifyComponentModified(nCurrentCPIndex, CurrentPoint);
     }
    
-    if ( ( bComponentNeedUpdate ) &&  ( !bCookOnlyOnMouseRelease ) )
+    if ( bComponentNeedUpdate )
     {
-        // Update and cook the asset
-        UpdateHoudiniComponents();
+        if ( !bCookOnlyOnMouseRelease )
+        {
+            // Update and cook the asset
+            UpdateHoudiniComponents();
+        }
+        else if ( bPreviewCookWhileDragging && !PreviewCookTickerHandle.IsValid() )
+        {
+            // Cook a preview of the dragged points as soon as the asset is ready for it
+            PreviewCookTickerHandle = FTicker::GetCoreTicker().AddTicker(
+                FTickerDelegate::CreateSP( this, &FHoudiniSplineComponentVisualizer::TickPreviewCook ) );
+        }
     }
 
     return true;
@@ -487,6 +508,53 @@ FHoudiniSplineComponentVisualizer::UpdateHoudiniComponents()
     bComponentNeedUpdate = false;
 }
 
+bool
+FHoudiniSplineComponentVisualizer::TickPreviewCook( float DeltaTime )
+{
+    if ( !EditedHoudiniSplineComponent || !bComponentNeedUpdate )
+    {
+        PreviewCookTickerHandle.Reset();
+        return false;
+    }
+
+    // Latest points win: while the previous preview is cooking or was requested too recently,
+    // newer points keep replacing the pending ones.
+    UHoudiniAssetComponent * HoudiniAssetComponent = EditedHoudiniSplineComponent->GetCookedHoudiniAssetComponent();
+    if ( HoudiniAssetComponent && HoudiniAssetComponent->IsInstantiatingOrCooking() )
+        return true;
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const double CurrentTime = FPlatformTime::Seconds();
+    if ( CurrentTime - LastPreviewCookTime < HoudiniRuntimeSettings->CurvePreviewCookInterval )
+        return true;
+
+    if ( HoudiniAssetComponent )
+        HoudiniAssetComponent->SetCurvePreviewCook( true );
+
+    UpdateHoudiniComponents();
+    LastPreviewCookTime = CurrentTime;
+
+    PreviewCookTickerHandle.Reset();
+    return false;
+}
+
+void
+FHoudiniSplineComponentVisualizer::EndPreviewCook()
+{
+    if ( PreviewCookTickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( PreviewCookTickerHandle );
+        PreviewCookTickerHandle.Reset();
+    }
+
+    if ( !EditedHoudiniSplineComponent )
+        return;
+
+    UHoudiniAssetComponent * HoudiniAssetComponent = EditedHoudiniSplineComponent->GetCookedHoudiniAssetComponent();
+    if ( HoudiniAssetComponent )
+        HoudiniAssetComponent->SetCurvePreviewCook( false );
+}
+
 void
 FHoudiniSplineComponentVisualizer::NotifyComponentModified( int32 PointIndex, const FTransform & Point )
 {
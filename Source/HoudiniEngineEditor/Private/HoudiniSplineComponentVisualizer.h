@@ -147,6 +147,12 @@ class FHoudiniSplineComponentVisualizer : public FComponentVisualizer
         /** Store the current rotation to orient the rotation gizmo properly **/
         void CacheRotation();
 
+        /** Ticker cooking a preview of the latest dragged points once the asset is ready for it. **/
+        bool TickPreviewCook( float DeltaTime );
+
+        /** Drop any pending preview, the asset goes back to full quality cooks. **/
+        void EndPreviewCook();
+
     protected:
 
         /** Visualizer actions. **/
@@ -173,6 +179,15 @@ class FHoudiniSplineComponentVisualizer : public FComponentVisualizer
         /** Indicates if the curves should only cook on mouse release **/
         bool bCookOnlyOnMouseRelease;
 
+        /** Indicates if previews are cooked while dragging, when curves only cook on mouse release **/
+        bool bPreviewCookWhileDragging;
+
+        /** Ticker waiting to cook a preview of the dragged points **/
+        FDelegateHandle PreviewCookTickerHandle;
+
+        /** Time the last preview cook was requested **/
+        double LastPreviewCookTime;
+
         /** Indicates wether or not a transaction should be recorded when moving a point **/
         bool bRecordTransactionOnMove;
 };
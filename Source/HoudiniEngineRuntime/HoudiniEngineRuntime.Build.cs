@@ -285,14 +285,17 @@ public class HoudiniEngineRuntime : ModuleRules
             {
                     "AppFramework",
                     "AssetTools",
+                    "DirectoryWatcher",
                     "EditorStyle",
                     "EditorWidgets",
                     "LevelEditor",
                     "MainFrame",
                     "MeshPaint",
+                    "MeshDescription",
+                    "MeshDescriptionOperations",
+                    "StaticMeshDescription",
                     "Projects",
                     "PropertyEditor",
-                    "RawMesh",
                     "Settings",
                     "Slate",
                     "SlateCore",
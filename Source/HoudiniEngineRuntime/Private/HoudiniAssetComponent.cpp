@@ -389,6 +389,10 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const FObjectInitializer & Objec
     ComponentGUID = FGuid::NewGuid();
 
     bEditorPropertiesNeedFullUpdate = true;
+    EditorPropertiesLayoutHash = 0;
+    bCurvePreviewCook = false;
+    bCurvePreviewParameterEnabled = false;
+    CurvePreviewParameterValue = 0;
 
     bFullyLoaded = false;
 
@@ -1454,6 +1458,9 @@ UHoudiniAssetComponent::PostCook( bool bCookError )
         return;
     }
 
+    // Keep the parts' attribute directories for the mesh creation and the components' update.
+    FHoudiniScopedAttributeDirectory ScopedAttributeDirectory;
+
     FTransform ComponentTransform;
     TMap< FHoudiniGeoPartObject, UStaticMesh * > NewStaticMeshes;
     
@@ -2054,6 +2061,14 @@ UHoudiniAssetComponent::UpdateEditorProperties( bool bConditionalUpdate )
     FPropertyEditorModule & PropertyModule =
         FModuleManager::Get().GetModuleChecked< FPropertyEditorModule >( "PropertyEditor" );
 
+    // Widgets are bound to the parameters, so conditional updates (after cooks) only need to rebuild the
+    // panel when its layout changed. Otherwise the bound widgets pick up the new values by themselves.
+    const uint32 LayoutHash = GetEditorLayoutHash();
+    const bool bForceRefresh =
+        bEditorPropertiesNeedFullUpdate && ( !bConditionalUpdate || LayoutHash != EditorPropertiesLayoutHash );
+    bool bDeferredUpdate = false;
+    bool bShownInDetailsPanel = false;
+
     // We want to iterate on all the details panel
     static const FName DetailsTabIdentifiers[] = { "LevelEditorSelectionDetails", "LevelEditorSelectionDetails2", "LevelEditorSelectionDetails3", "LevelEditorSelectionDetails4" };
     for (const FName& DetailsPanelName : DetailsTabIdentifiers )
@@ -2101,17 +2116,19 @@ UHoudiniAssetComponent::UpdateEditorProperties( bool bConditionalUpdate )
             {
                 // We want to avoid UI update if this is a conditional update and widget has captured the mouse.
                 StartHoudiniUIUpdateTicking();
+                bDeferredUpdate = true;
                 continue;
             }
 
             TArray< UObject * > SelectedActors;
             SelectedActors.Add( HoudiniAssetActor );
+            bShownInDetailsPanel = true;
 
             // bEditorPropertiesNeedFullUpdate is false only when small changes (parameters value) have been made
             // We do not reselect the actor to avoid loosing the current selected parameter
 
             // Reset selected actor to itself, force refresh and override the lock.
-            DetailsView->SetObjects( SelectedActors, bEditorPropertiesNeedFullUpdate, true );
+            DetailsView->SetObjects( SelectedActors, bForceRefresh, true );
 
             if ( !bEditorPropertiesNeedFullUpdate )
                 bEditorPropertiesNeedFullUpdate = true;
@@ -2124,6 +2141,81 @@ UHoudiniAssetComponent::UpdateEditorProperties( bool bConditionalUpdate )
 
         StopHoudiniUIUpdateTicking();
     }
+
+    // Remember what the panel has been built from. A panel that isn't showing us will be built from the
+    // current state when it does.
+    if ( !bDeferredUpdate && ( bForceRefresh || !bShownInDetailsPanel ) )
+        EditorPropertiesLayoutHash = LayoutHash;
+}
+
+uint32
+UHoudiniAssetComponent::GetEditorLayoutHash() const
+{
+    // Parameters, combined independently of map order.
+    TArray< uint32 > ParameterHashes;
+    ParameterHashes.Reserve( Parameters.Num() + Inputs.Num() + InstanceInputs.Num() );
+    for ( const auto & ParmPair : Parameters )
+    {
+        if ( ParmPair.Value && !ParmPair.Value->IsPendingKill() )
+            ParameterHashes.Add( ParmPair.Value->GetEditorLayoutHash() );
+    }
+    ParameterHashes.Sort();
+
+    uint32 Hash = 0;
+    for ( uint32 ParameterHash : ParameterHashes )
+        Hash = HashCombine( Hash, ParameterHash );
+
+    // Inputs.
+    for ( const UHoudiniAssetInput * HoudiniAssetInput : Inputs )
+    {
+        Hash = HashCombine( Hash, PointerHash( HoudiniAssetInput ) );
+        if ( HoudiniAssetInput && !HoudiniAssetInput->IsPendingKill() )
+            Hash = HashCombine( Hash, ::GetTypeHash( (int32) HoudiniAssetInput->GetChoiceIndex() ) );
+    }
+
+    // Instancers and their instanced objects.
+    for ( const UHoudiniAssetInstanceInput * InstanceInput : InstanceInputs )
+    {
+        Hash = HashCombine( Hash, PointerHash( InstanceInput ) );
+        if ( !InstanceInput || InstanceInput->IsPendingKill() )
+            continue;
+
+        for ( const UHoudiniAssetInstanceInputField * InstanceInputField : InstanceInput->GetInstanceInputFields() )
+        {
+            Hash = HashCombine( Hash, PointerHash( InstanceInputField ) );
+            if ( InstanceInputField && !InstanceInputField->IsPendingKill() )
+                Hash = HashCombine( Hash, ::GetTypeHash( InstanceInputField->InstanceVariationCount() ) );
+        }
+    }
+
+    // Generated meshes with their bake names and materials.
+    for ( const auto & MeshPair : StaticMeshes )
+    {
+        const UStaticMesh * StaticMesh = MeshPair.Value;
+        Hash = HashCombine( Hash, PointerHash( StaticMesh ) );
+        if ( !StaticMesh || StaticMesh->IsPendingKill() )
+            continue;
+
+        if ( const FString * BakeNameOverride = BakeNameOverrides.Find( MeshPair.Key ) )
+            Hash = HashCombine( Hash, ::GetTypeHash( *BakeNameOverride ) );
+
+        for ( const FStaticMaterial & StaticMaterial : StaticMesh->StaticMaterials )
+            Hash = HashCombine( Hash, PointerHash( StaticMaterial.MaterialInterface ) );
+    }
+
+    // Generated landscapes and their materials.
+    for ( const auto & LandscapePair : LandscapeComponents )
+    {
+        const ALandscapeProxy * Landscape = LandscapePair.Value.Get();
+        Hash = HashCombine( Hash, PointerHash( Landscape ) );
+        if ( Landscape && !Landscape->IsPendingKill() )
+        {
+            Hash = HashCombine( Hash, PointerHash( Landscape->GetLandscapeMaterial() ) );
+            Hash = HashCombine( Hash, PointerHash( Landscape->GetLandscapeHoleMaterial() ) );
+        }
+    }
+
+    return Hash;
 }
 
 void
@@ -3124,6 +3216,7 @@ UHoudiniAssetComponent::SetBakeFolder( const FString& Folder )
         BakeFolder = NewBakeFolder;
         BakedStaticMeshPackagesForParts.Empty();
         BakedMaterialPackagesForIds.Empty();
+        BakedTexturesForHashes.Empty();
     }
 }
 
@@ -4516,6 +4609,32 @@ UHoudiniAssetComponent::NotifyHoudiniSplineChanged( UHoudiniSplineComponent * Ho
     StartHoudiniTicking();
 }
 
+void
+UHoudiniAssetComponent::SetCurvePreviewCook( bool bInCurvePreviewCook )
+{
+    if ( bCurvePreviewCook == bInCurvePreviewCook )
+        return;
+
+    bCurvePreviewCook = bInCurvePreviewCook;
+
+    if ( bCurvePreviewParameterEnabled == bCurvePreviewCook || !FHoudiniEngineUtils::IsValidNodeId( AssetId ) )
+        return;
+
+    // The preview parameter is usually invisible and has no parameter object, look it up on the node.
+    HAPI_ParmId PreviewParmId = -1;
+    if ( FHoudiniApi::GetParmIdFromName(
+        FHoudiniEngine::Get().GetSession(), AssetId,
+        HAPI_UNREAL_PARAM_CURVE_PREVIEW, &PreviewParmId ) != HAPI_RESULT_SUCCESS )
+        return;
+
+    // The preview parameter is switched with the next parameter upload.
+    if ( PreviewParmId >= 0 )
+    {
+        bParametersChanged = true;
+        StartHoudiniTicking();
+    }
+}
+
 void
 UHoudiniAssetComponent::UnmarkChangedParameters()
 {
@@ -4555,7 +4674,8 @@ UHoudiniAssetComponent::UploadChangedParameters()
             }
         }
 
-        // Upload parameters.
+        // Upload parameters. Int and float values are queued and sent as contiguous ranges.
+        FHoudiniParmValuesUpload ValuesUpload( AssetId );
         for ( TMap< HAPI_ParmId, UHoudiniAssetParameter * >::TIterator IterParams( Parameters ); IterParams; ++IterParams )
         {
             UHoudiniAssetParameter * HoudiniAssetParameter = IterParams.Value();
@@ -4568,6 +4688,48 @@ UHoudiniAssetComponent::UploadChangedParameters()
                 Success &= HoudiniAssetParameter->UploadParameterValue();
             }
         }
+
+        // Curve drag previews cook with the preview parameter enabled, the next full cook restores its value.
+        if ( bCurvePreviewParameterEnabled != bCurvePreviewCook )
+        {
+            HAPI_ParmId PreviewParmId = -1;
+            FHoudiniApi::GetParmIdFromName(
+                FHoudiniEngine::Get().GetSession(), AssetId,
+                HAPI_UNREAL_PARAM_CURVE_PREVIEW, &PreviewParmId );
+
+            if ( PreviewParmId >= 0 )
+            {
+                UHoudiniAssetParameter * PreviewParameter = FindParameter( TEXT( HAPI_UNREAL_PARAM_CURVE_PREVIEW ) );
+                if ( bCurvePreviewCook )
+                {
+                    // Keep the value of invisible preview parameters, they have no parameter object to restore it from.
+                    if ( !PreviewParameter )
+                    {
+                        FHoudiniApi::GetParmIntValue(
+                            FHoudiniEngine::Get().GetSession(), AssetId,
+                            HAPI_UNREAL_PARAM_CURVE_PREVIEW, 0, &CurvePreviewParameterValue );
+                    }
+
+                    Success &= ( FHoudiniApi::SetParmIntValue(
+                        FHoudiniEngine::Get().GetSession(), AssetId,
+                        HAPI_UNREAL_PARAM_CURVE_PREVIEW, 0, 1 ) == HAPI_RESULT_SUCCESS );
+                }
+                else if ( PreviewParameter )
+                {
+                    Success &= PreviewParameter->UploadParameterValue();
+                }
+                else
+                {
+                    Success &= ( FHoudiniApi::SetParmIntValue(
+                        FHoudiniEngine::Get().GetSession(), AssetId,
+                        HAPI_UNREAL_PARAM_CURVE_PREVIEW, 0, CurvePreviewParameterValue ) == HAPI_RESULT_SUCCESS );
+                }
+            }
+
+            bCurvePreviewParameterEnabled = bCurvePreviewCook;
+        }
+
+        Success &= ValuesUpload.Flush();
     }
 
     if( !Success )
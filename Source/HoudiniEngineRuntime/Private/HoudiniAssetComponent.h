@@ -228,12 +228,19 @@ public:
         /** Refresh editor's detail panel and update properties. **/
         void UpdateEditorProperties( bool bConditionalUpdate );
 
+        /** Return a hash of everything the details panel builds static widgets from: parameter layout, inputs    **/
+        /** and generated outputs. Parameter values are bound to the widgets and are not part of it.              **/
+        uint32 GetEditorLayoutHash() const;
+
         /** Callback used by parameters to notify component about their changes. **/
         void NotifyParameterChanged( UHoudiniAssetParameter * HoudiniAssetParameter );
 
         /** Notification used by spline visualizer to notify main Houdini asset component about spline change. **/
         void NotifyHoudiniSplineChanged( UHoudiniSplineComponent * HoudiniSplineComponent );
 
+        /** Used by spline visualizer while dragging curve points, cooks with the curve preview parameter enabled. **/
+        void SetCurvePreviewCook( bool bInCurvePreviewCook );
+
         /** Used by Blueprint baking; create temporary actor and necessary components to bake a blueprint. **/
         AActor * CloneComponentsAndCreateActor();
 
@@ -685,6 +692,8 @@ public:
         TMap<FHoudiniGeoPartObject, TWeakObjectPtr<class UPackage> > BakedStaticMeshPackagesForParts;
         /** Transient cache of last baked materials and textures */
         TMap<FString, TWeakObjectPtr<class UPackage> > BakedMaterialPackagesForIds;
+        /** Transient cache of baked textures, keyed by content hash */
+        TMap<FString, TWeakObjectPtr<class UTexture2D> > BakedTexturesForHashes;
 
         /** Cache of the temp cook content packages created by the asset for its meshes                             **/
         TMap<FHoudiniGeoPartObject, TWeakObjectPtr<class UPackage> > CookedTemporaryStaticMeshPackages;
@@ -698,6 +707,18 @@ public:
         /** (default behavior is true)                                                                              **/
         bool bEditorPropertiesNeedFullUpdate;
 
+        /** Layout hash the details panel was last built from, conditional updates skip the rebuild if unchanged.  **/
+        uint32 EditorPropertiesLayoutHash;
+
+        /** Whether cooks are curve drag previews. **/
+        bool bCurvePreviewCook;
+
+        /** Whether the curve preview parameter is currently enabled on the asset. **/
+        bool bCurvePreviewParameterEnabled;
+
+        /** Value of the curve preview parameter before it was enabled, restored by the next full cook. **/
+        int32 CurvePreviewParameterValue;
+
         /** Overrides for baking names per part */
         TMap< FHoudiniGeoPartObject, FString > BakeNameOverrides;
 
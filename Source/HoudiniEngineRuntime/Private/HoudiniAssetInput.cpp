@@ -37,6 +37,7 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniLandscapeUtils.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniParamUtils.h"
 
 #include "Components/SplineComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -177,6 +178,10 @@ FHoudiniAssetInputOutlinerMesh::HasSplineComponentChanged(float fCurrentSplineRe
     if ( SplineResolution != fCurrentSplineResolution )
         return true;
 
+    // Spline max error setting has changed?
+    if ( SplineMaxError >= 0.0f && SplineMaxError != FHoudiniEngineUtils::GetMarshallingSplineMaxError() )
+        return true;
+
     // Has any of the CV's transform been modified?
     for ( int32 n = 0; n < SplineControlPointsTransform.Num(); n++ )
     {
@@ -842,6 +847,7 @@ UHoudiniAssetInput::UploadParameterValue()
             if ( bLoadedParameter || bCreated )
             {
                 // If we just loaded or created our curve, we need to set parameters.
+                FHoudiniParmValuesUpload ValuesUpload( ConnectedAssetId );
                 for (TMap< FString, UHoudiniAssetParameter * >::TIterator
                     IterParams(InputCurveParameters); IterParams; ++IterParams)
                 {
@@ -855,6 +861,8 @@ UHoudiniAssetInput::UploadParameterValue()
                     // Upload parameter value.
                     Success &= Parameter->UploadParameterValue();
                 }
+
+                Success &= ValuesUpload.Flush();
             }
 
             if ( ConnectedAssetId != -1 && InputCurve && !InputCurve->IsPendingKill() )
@@ -2277,16 +2285,12 @@ bool
 UHoudiniAssetInput::UpdateInputCurve()
 {
     bool Success = true;
-    FString CurvePointsString;
     EHoudiniSplineComponentType::Enum CurveTypeValue = EHoudiniSplineComponentType::Bezier;
     EHoudiniSplineComponentMethod::Enum CurveMethodValue = EHoudiniSplineComponentMethod::CVs;
     int32 CurveClosed = 1;
 
     if(ConnectedAssetId != -1)
     {
-        FHoudiniEngineUtils::HapiGetParameterDataAsString(
-            ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_COORDS, TEXT( "" ),
-            CurvePointsString );
         FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
             ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_TYPE,
             (int32) EHoudiniSplineComponentType::Bezier, (int32 &) CurveTypeValue );
@@ -2317,10 +2321,6 @@ UHoudiniAssetInput::UpdateInputCurve()
         HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_POSITION,
         AttributeRefinedCurvePositions, RefinedCurvePositions );
 
-    // Process coords string and extract positions.
-    TArray< FVector > CurvePoints;
-    FHoudiniEngineUtils::ExtractStringPositions( CurvePointsString, CurvePoints );
-
     TArray< FVector > CurveDisplayPoints;
     FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( RefinedCurvePositions, CurveDisplayPoints );
 
@@ -50,6 +50,16 @@ namespace EHoudiniAssetInputType
     };
 }
 
+/** Points sampled from an Unreal spline, and the hash of the spline and settings they were sampled from. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniSplineSamples
+{
+    TArray< FVector > Positions;
+    TArray< FQuat > Rotations;
+    TArray< FVector > Scales;
+
+    uint32 Hash = 0;
+};
+
 struct HOUDINIENGINERUNTIME_API FHoudiniAssetInputOutlinerMesh
 {
     FHoudiniAssetInputOutlinerMesh()
@@ -61,6 +71,7 @@ struct HOUDINIENGINERUNTIME_API FHoudiniAssetInputOutlinerMesh
         SplineControlPointsTransform(),
         SplineLength(-1.0f),
         SplineResolution(-1.0f),
+        SplineMaxError(-1.0f),
         ActorTransform(),
         ComponentTransform(),
         AssetId(-1),
@@ -121,6 +132,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniAssetInputOutlinerMesh
     /** Spline resolution used to generate the asset, used to detect setting modification **/
     float SplineResolution = -1.0f;
 
+    /** Spline max error used to generate the asset, used to detect setting modification. -1 if unknown. Not serialized. **/
+    float SplineMaxError = -1.0f;
+
+    /** Last samples of the spline, reused while its control points are unchanged. Not serialized. **/
+    FHoudiniSplineSamples SplineSamples;
+
     /** Actor transform used to see if the transfrom changed since last marshal into Houdini. **/
     FTransform ActorTransform;
 
@@ -834,28 +834,33 @@ UHoudiniAssetInstanceInputField::GetProcessedTransforms( TArray<FTransform>& Pro
     for (int32 InstanceIdx = 0; InstanceIdx < VariationTransformsArray[ VariationIdx ].Num(); ++InstanceIdx)
     {
         CurrentTransform = VariationTransformsArray[VariationIdx][ InstanceIdx ];
+        if ( ProcessTransform( CurrentTransform, VariationIdx ) )
+            ProcessedTransforms.Add( CurrentTransform );
+    }
+}
 
-        // Compute new rotation and scale.
-        FQuat TransformRotation = CurrentTransform.GetRotation() * GetRotationOffset( VariationIdx ).Quaternion();
-        FVector TransformScale3D = CurrentTransform.GetScale3D() * GetScaleOffset( VariationIdx );
+bool
+UHoudiniAssetInstanceInputField::ProcessTransform( FTransform& Transform, const int32& VariationIdx ) const
+{
+    // Compute new rotation and scale.
+    FQuat TransformRotation = Transform.GetRotation() * GetRotationOffset( VariationIdx ).Quaternion();
+    FVector TransformScale3D = Transform.GetScale3D() * GetScaleOffset( VariationIdx );
 
-        // Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
-        // Happens in blueprint as well.
-        // We want to make sure the scale is not too small, but keep negative values! (Bug 90876)
-        if (FMath::Abs(TransformScale3D.X) < HAPI_UNREAL_SCALE_SMALL_VALUE)
-            TransformScale3D.X = (TransformScale3D.X > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+    // Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
+    // Happens in blueprint as well.
+    // We want to make sure the scale is not too small, but keep negative values! (Bug 90876)
+    if (FMath::Abs(TransformScale3D.X) < HAPI_UNREAL_SCALE_SMALL_VALUE)
+        TransformScale3D.X = (TransformScale3D.X > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
 
-        if (FMath::Abs(TransformScale3D.Y) < HAPI_UNREAL_SCALE_SMALL_VALUE)
-            TransformScale3D.Y = (TransformScale3D.Y > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+    if (FMath::Abs(TransformScale3D.Y) < HAPI_UNREAL_SCALE_SMALL_VALUE)
+        TransformScale3D.Y = (TransformScale3D.Y > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
 
-        if (FMath::Abs(TransformScale3D.Z) < HAPI_UNREAL_SCALE_SMALL_VALUE)
-            TransformScale3D.Z = (TransformScale3D.Z > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
+    if (FMath::Abs(TransformScale3D.Z) < HAPI_UNREAL_SCALE_SMALL_VALUE)
+        TransformScale3D.Z = (TransformScale3D.Z > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
 
-        CurrentTransform.SetRotation(TransformRotation);
-        CurrentTransform.SetScale3D(TransformScale3D);
+    Transform.SetRotation(TransformRotation);
+    Transform.SetScale3D(TransformScale3D);
 
-        if ( CurrentTransform.IsValid() )
-            ProcessedTransforms.Add( CurrentTransform );
-    }
+    return Transform.IsValid();
 }
 
@@ -139,6 +139,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInputField : public UObject
         /** Return the array of processed transforms **/
         void GetProcessedTransforms(TArray<FTransform>& ProcessedTransform, const int32& VariationIdx) const;
 
+        /** Apply the variation's rotation and scale offsets to a transform, returns false if the result is invalid **/
+        bool ProcessTransform(FTransform& Transform, const int32& VariationIdx) const;
+
         /** Recreates render states for instanced static mesh component. **/
         void RecreateRenderState();
 
@@ -32,6 +32,7 @@
 #include "HoudiniAssetParameterRamp.h"
 #include "HoudiniPluginSerializationVersion.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 
 #include "Misc/Variant.h"
@@ -310,6 +311,23 @@ UHoudiniAssetParameter::PostEditUndo()
     MarkChanged();
 }
 
+uint32
+UHoudiniAssetParameter::GetEditorLayoutHash() const
+{
+    uint32 Hash = PointerHash( this );
+    Hash = HashCombine( Hash, PointerHash( GetClass() ) );
+    Hash = HashCombine( Hash, PointerHash( ParentParameter ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( ChildIndex ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( TupleSize ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( MultiparmInstanceIndex ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( ActiveChildParameter ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( ChildParameters.Num() ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( (bool) bIsDisabled ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( ParameterLabel ) );
+    Hash = HashCombine( Hash, ::GetTypeHash( ParameterHelp ) );
+    return Hash;
+}
+
 #endif // WITH_EDITOR
 
 void
@@ -334,13 +352,10 @@ UHoudiniAssetParameter::IsVisible( const HAPI_ParmInfo & ParmInfo ) const
 bool
 UHoudiniAssetParameter::SetNameAndLabel( const HAPI_ParmInfo & ParmInfo )
 {
-    FHoudiniEngineString HoudiniEngineStringName( ParmInfo.nameSH );
-    FHoudiniEngineString HoudiniEngineStringLabel( ParmInfo.labelSH );
-
     bool bresult = true;
 
-    bresult |= HoudiniEngineStringName.ToFString( ParameterName );
-    bresult |= HoudiniEngineStringLabel.ToFString( ParameterLabel );
+    bresult |= FHoudiniParamUtils::ToFString( ParmInfo.nameSH, ParameterName );
+    bresult |= FHoudiniParamUtils::ToFString( ParmInfo.labelSH, ParameterLabel );
 
     return bresult;
 }
@@ -370,10 +385,8 @@ UHoudiniAssetParameter::SetNameAndLabel( const FString & Name )
 bool
 UHoudiniAssetParameter::SetHelp( const HAPI_ParmInfo & ParmInfo )
 {
-    FHoudiniEngineString HoudiniEngineStringHelp( ParmInfo.helpSH );
-
     bool bresult = true;
-    bresult = HoudiniEngineStringHelp.ToFString( ParameterHelp );
+    bresult = FHoudiniParamUtils::ToFString( ParmInfo.helpSH, ParameterHelp );
 
     return bresult;
 }
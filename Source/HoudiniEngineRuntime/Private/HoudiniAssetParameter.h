@@ -142,6 +142,10 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameter : public UObject
 
         virtual void PostEditUndo() override;
 
+        /** Return a hash of the state the details panel builds this parameter's widgets from. Values that widgets  **/
+        /** read through Slate attributes are left out, changing those alone does not require a panel rebuild.     **/
+        virtual uint32 GetEditorLayoutHash() const;
+
 #endif // WITH_EDITOR
 
     protected:
@@ -27,6 +27,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 
@@ -81,6 +82,10 @@ UHoudiniAssetParameterButton::CreateParameter(
 bool
 UHoudiniAssetParameterButton::UploadParameterValue()
 {
+    // Callbacks run on press and may read other values, send values queued so far first.
+    if ( FHoudiniParmValuesUpload * ValuesUpload = FHoudiniParmValuesUpload::Get( NodeId ) )
+        ValuesUpload->Flush();
+
     int32 PressValue = 1;
     if ( FHoudiniApi::SetParmIntValues(
         FHoudiniEngine::Get().GetSession(), NodeId, &PressValue, ValuesIndex, 1 ) != HAPI_RESULT_SUCCESS )
@@ -29,6 +29,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -92,12 +93,8 @@ UHoudiniAssetParameterChoice::CreateParameter(
         // Assign internal Hapi values index.
         SetValuesIndex( ParmInfo.intValuesIndex );
 
-        if ( FHoudiniApi::GetParmIntValues(
-            FHoudiniEngine::Get().GetSession(), NodeId, &CurrentValue,
-            ValuesIndex, TupleSize) != HAPI_RESULT_SUCCESS )
-        {
+        if ( !FHoudiniParamUtils::GetParmIntValues( NodeId, &CurrentValue, ValuesIndex, TupleSize ) )
             return false;
-        }
         if( CurrentValue >= ParmInfo.choiceCount )
         {
             HOUDINI_LOG_WARNING(TEXT("parm '%s' has an invalid value %d, menu tokens are not supported for choice menus"), *GetParameterName(), CurrentValue);
@@ -112,32 +109,15 @@ UHoudiniAssetParameterChoice::CreateParameter(
         // Assign internal Hapi values index.
         SetValuesIndex( ParmInfo.stringValuesIndex );
 
-        HAPI_StringHandle StringHandle;
-        if ( FHoudiniApi::GetParmStringValues(
-            FHoudiniEngine::Get().GetSession(), NodeId, false,
-            &StringHandle, ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-        {
-            return false;
-        }
-
         // Get the actual string value.
-        FHoudiniEngineString HoudiniEngineString( StringHandle );
-        if ( !HoudiniEngineString.ToFString( StringValue ) )
+        if ( !FHoudiniParamUtils::GetParmStringValues( NodeId, &StringValue, ValuesIndex, 1 ) )
             return false;
     }
 
     // Get choice descriptors.
     TArray< HAPI_ParmChoiceInfo > ParmChoices;
-    ParmChoices.SetNumUninitialized( ParmInfo.choiceCount );
-    for (int32 Idx = 0; Idx < ParmChoices.Num(); Idx++)
-        FHoudiniApi::ParmChoiceInfo_Init(&(ParmChoices[Idx]));
-
-    if ( FHoudiniApi::GetParmChoiceLists(
-        FHoudiniEngine::Get().GetSession(), NodeId, &ParmChoices[ 0 ],
-        ParmInfo.choiceIndex, ParmInfo.choiceCount ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::GetParmChoiceLists( NodeId, ParmChoices, ParmInfo.choiceIndex, ParmInfo.choiceCount ) )
         return false;
-    }
 
     // Get string values for all available choices.
     StringChoiceValues.Empty();
@@ -150,16 +130,14 @@ UHoudiniAssetParameterChoice::CreateParameter(
         FString * ChoiceLabel = new FString();
 
         {
-            FHoudiniEngineString HoudiniEngineString( ParmChoices[ ChoiceIdx ].valueSH );
-            if ( !HoudiniEngineString.ToFString( *ChoiceValue ) )
+            if ( !FHoudiniParamUtils::ToFString( ParmChoices[ ChoiceIdx ].valueSH, *ChoiceValue ) )
                 return false;
 
             StringChoiceValues.Add( TSharedPtr< FString >( ChoiceValue ) );
         }
 
         {
-            FHoudiniEngineString HoudiniEngineString( ParmChoices[ ChoiceIdx ].labelSH );
-            if ( !HoudiniEngineString.ToFString( *ChoiceLabel ) )
+            if ( !FHoudiniParamUtils::ToFString( ParmChoices[ ChoiceIdx ].labelSH, *ChoiceLabel ) )
                 return false;
 
             StringChoiceLabels.Add( TSharedPtr< FString >( ChoiceLabel ) );
@@ -242,7 +220,7 @@ UHoudiniAssetParameterChoice::UploadParameterValue()
     else
     {
         // This is an int choice list.
-        FHoudiniApi::SetParmIntValues( FHoudiniEngine::Get().GetSession(), NodeId, &CurrentValue, ValuesIndex, TupleSize );
+        FHoudiniParamUtils::SetParmIntValues( NodeId, &CurrentValue, ValuesIndex, TupleSize );
     }
 
     return Super::UploadParameterValue();
@@ -431,6 +409,16 @@ UHoudiniAssetParameterChoice::HandleChoiceContentText() const
     return FText::FromString( StringValue );
 }
 
+uint32
+UHoudiniAssetParameterChoice::GetEditorLayoutHash() const
+{
+    uint32 Hash = HashCombine( Super::GetEditorLayoutHash(), ::GetTypeHash( CurrentValue ) );
+    for ( const TSharedPtr< FString > & ChoiceLabel : StringChoiceLabels )
+        Hash = HashCombine( Hash, ChoiceLabel.IsValid() ? ::GetTypeHash( *ChoiceLabel ) : 0 );
+
+    return Hash;
+}
+
 #endif // WITH_EDITOR
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -89,6 +89,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterChoice : public UHoudiniAss
         /** Called to retrieve the name of selected item. **/
         FText HandleChoiceContentText() const;
 
+        /** Combo boxes are built from the choice labels and initial selection. **/
+        virtual uint32 GetEditorLayoutHash() const override;
+
 #endif // WITH_EDITOR
 
     protected:
@@ -27,6 +27,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -95,12 +96,8 @@ UHoudiniAssetParameterColor::CreateParameter(
 
     // Get the actual value for this property.
     Color = FLinearColor::White;
-    if ( FHoudiniApi::GetParmFloatValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId,
-        (float *) &Color.R, ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::GetParmFloatValues( InNodeId, (float *) &Color.R, ValuesIndex, TupleSize ) )
         return false;
-    }
 
     if ( TupleSize == 3 )
         Color.A = 1.0f;
@@ -111,11 +108,8 @@ UHoudiniAssetParameterColor::CreateParameter(
 bool
 UHoudiniAssetParameterColor::UploadParameterValue()
 {
-    if ( FHoudiniApi::SetParmFloatValues(
-        FHoudiniEngine::Get().GetSession(), NodeId, (const float*)&Color.R, ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::SetParmFloatValues( NodeId, (const float*)&Color.R, ValuesIndex, TupleSize ) )
         return false;
-    }
 
     return Super::UploadParameterValue();
 }
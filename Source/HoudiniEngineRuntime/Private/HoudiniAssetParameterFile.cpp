@@ -30,6 +30,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 #include "Internationalization/Internationalization.h"
 #include "Misc/Paths.h"
@@ -120,32 +121,18 @@ UHoudiniAssetParameterFile::CreateParameter(
     SetValuesIndex( ParmInfo.stringValuesIndex );
 
     // Get the actual value for this property.
-    TArray< HAPI_StringHandle > StringHandles;
-    StringHandles.SetNumZeroed( TupleSize );
-    if ( FHoudiniApi::GetParmStringValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, false,
-        &StringHandles[ 0 ], ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-    {
+    Values.SetNum( TupleSize );
+    if ( !FHoudiniParamUtils::GetParmStringValues( InNodeId, Values.GetData(), ValuesIndex, TupleSize ) )
         return false;
-    }
 
-    // Convert HAPI string handles to Unreal strings.
-    Values.SetNum( TupleSize );
+    // Detect and update relative paths.
     for ( int32 Idx = 0; Idx < TupleSize; ++Idx )
-    {
-        FString ValueString = TEXT( "" );
-        FHoudiniEngineString HoudiniEngineString( StringHandles[ Idx ] );
-        HoudiniEngineString.ToFString( ValueString );
-
-        // Detect and update relative paths.
-        Values[ Idx ] = UpdateCheckRelativePath( ValueString );
-    }
+        Values[ Idx ] = UpdateCheckRelativePath( Values[ Idx ] );
 
     // Retrieve filters for this file.
     if ( ParmInfo.typeInfoSH > 0 )
     {
-        FHoudiniEngineString HoudiniEngineString( ParmInfo.typeInfoSH );
-        if ( HoudiniEngineString.ToFString( Filters ) )
+        if ( FHoudiniParamUtils::ToFString( ParmInfo.typeInfoSH, Filters ) )
         {
             if ( !Filters.IsEmpty() )
                 ParameterLabel = FString::Printf( TEXT( "%s (%s)" ), *ParameterLabel, *Filters );
@@ -246,6 +233,16 @@ UHoudiniAssetParameterFile::HandleFilePathPickerPathPicked( const FString & Pick
     MarkChanged();
 }
 
+uint32
+UHoudiniAssetParameterFile::GetEditorLayoutHash() const
+{
+    uint32 Hash = HashCombine( Super::GetEditorLayoutHash(), ::GetTypeHash( Filters ) );
+    for ( const FString & Value : Values )
+        Hash = HashCombine( Hash, ::GetTypeHash( Value ) );
+
+    return Hash;
+}
+
 #endif
 
 FString
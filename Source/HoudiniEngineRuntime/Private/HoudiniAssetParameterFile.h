@@ -71,6 +71,13 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterFile : public UHoudiniAsset
 
         void HandleFilePathPickerPathPicked( const FString & PickedPath, int32 Idx );
 
+    public:
+
+        /** File pickers are built from the values and filters. **/
+        virtual uint32 GetEditorLayoutHash() const override;
+
+    protected:
+
 #endif
 
     public:
@@ -29,6 +29,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -118,12 +119,8 @@ UHoudiniAssetParameterFloat::CreateParameter(
     Values.SetNumZeroed(TupleSize);
 
     // Get the actual value for this property.
-    if ( FHoudiniApi::GetParmFloatValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::GetParmFloatValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
         return false;
-    }
 
     // Set min and max for this property.
     if ( ParmInfo.hasMin )
@@ -178,8 +175,7 @@ UHoudiniAssetParameterFloat::CreateParameter(
         // If we are using defaults, we can detect some most common parameter names and alter defaults.
 
         FString LocalParameterName = TEXT( "" );
-        FHoudiniEngineString HoudiniEngineString( ParmInfo.nameSH );
-        HoudiniEngineString.ToFString( LocalParameterName );
+        FHoudiniParamUtils::ToFString( ParmInfo.nameSH, LocalParameterName );
 
         static const FString ParameterNameTranslate( TEXT( HAPI_UNREAL_PARAM_TRANSLATE ) );
         static const FString ParameterNameRotate( TEXT( HAPI_UNREAL_PARAM_ROTATE ) );
@@ -218,11 +214,8 @@ UHoudiniAssetParameterFloat::UploadParameterValue()
     if ( Values.Num() <= 0 )
         return false;
 
-    if ( FHoudiniApi::SetParmFloatValues( FHoudiniEngine::Get().GetSession(), NodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::SetParmFloatValues( NodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
         return false;
-    }
 
     return Super::UploadParameterValue();
 }
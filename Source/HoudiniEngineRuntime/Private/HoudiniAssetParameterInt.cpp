@@ -28,6 +28,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -89,12 +90,8 @@ UHoudiniAssetParameterInt::CreateParameter(
 
     // Get the actual value for this property.
     Values.SetNumZeroed( TupleSize );
-    if ( FHoudiniApi::GetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::GetParmIntValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
         return false;
-    }
 
     // Set min and max for this property.
     if ( ParmInfo.hasMin )
@@ -152,12 +149,8 @@ UHoudiniAssetParameterInt::UploadParameterValue()
     if ( Values.Num() <= 0 )
         return false;
 
-    if ( FHoudiniApi::SetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), NodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::SetParmIntValues( NodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
         return false;
-    }
 
     return Super::UploadParameterValue();
 }
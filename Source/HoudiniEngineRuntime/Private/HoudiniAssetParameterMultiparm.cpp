@@ -28,6 +28,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniParamUtils.h"
 
 #include "Internationalization/Internationalization.h"
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
@@ -37,6 +38,7 @@ UHoudiniAssetParameterMultiparm::UHoudiniAssetParameterMultiparm( const FObjectI
     , MultiparmValue( 0 )
     , LastModificationType( RegularValueChange )
     , LastRemoveAddInstanceIndex( -1 )
+    , NumDisplayedInstances( HAPI_UNREAL_MULTIPARM_INSTANCES_PER_PAGE )
 {}
 
 UHoudiniAssetParameterMultiparm *
@@ -80,10 +82,9 @@ UHoudiniAssetParameterMultiparm::CreateParameter(
 
     // Get the actual value for this property.
     MultiparmValue = 0;
-    HOUDINI_CHECK_ERROR_RETURN(
-        FHoudiniApi::GetParmIntValues( 
-            FHoudiniEngine::Get().GetSession(), InNodeId, &MultiparmValue, ValuesIndex, 1 )
-        , false );
+    if ( !FHoudiniParamUtils::GetParmIntValues( InNodeId, &MultiparmValue, ValuesIndex, 1 ) )
+        return false;
+
     return true;
 }
 
@@ -152,6 +153,10 @@ UHoudiniAssetParameterMultiparm::RemoveMultiparmInstance( int32 ChildMultiparmIn
 bool
 UHoudiniAssetParameterMultiparm::UploadParameterValue()
 {
+    // Changing the instance count changes the node's parameters, send values queued so far first.
+    if ( FHoudiniParmValuesUpload * ValuesUpload = FHoudiniParmValuesUpload::Get( NodeId ) )
+        ValuesUpload->Flush();
+
     if ( FHoudiniApi::SetParmIntValues(
         FHoudiniEngine::Get().GetSession(), NodeId,
         &MultiparmValue, ValuesIndex, 1 ) != HAPI_RESULT_SUCCESS )
@@ -108,4 +108,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterMultiparm : public UHoudini
         /** Last remove/add instance index. **/
         int32 LastRemoveAddInstanceIndex;
 
+        /** Number of instances the details panel builds widgets for, more are added a page at a time. Transient. **/
+        int32 NumDisplayedInstances;
+
 };
@@ -29,6 +29,7 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -81,24 +82,9 @@ UHoudiniAssetParameterString::CreateParameter(
     SetValuesIndex( ParmInfo.stringValuesIndex );
 
     // Get the actual value for this property.
-    TArray< HAPI_StringHandle > StringHandles;
-    StringHandles.SetNumZeroed( TupleSize );
-    if ( FHoudiniApi::GetParmStringValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, false,
-        &StringHandles[ 0 ], ValuesIndex, TupleSize) != HAPI_RESULT_SUCCESS )
-    {
-        return false;
-    }
-
-    // Convert HAPI string handles to Unreal strings.
     Values.SetNum( TupleSize );
-    for ( int32 Idx = 0; Idx < TupleSize; ++Idx )
-    {
-        FString ValueString = TEXT( "" );
-        FHoudiniEngineString HoudiniEngineString( StringHandles[ Idx ] );
-        HoudiniEngineString.ToFString( ValueString );
-        Values[ Idx ] = ValueString;
-    }
+    if ( !FHoudiniParamUtils::GetParmStringValues( InNodeId, Values.GetData(), ValuesIndex, TupleSize ) )
+        return false;
 
     return true;
 }
@@ -190,6 +176,16 @@ UHoudiniAssetParameterString::SetValueCommitted( const FText & InValue, ETextCom
     MarkChanged();
 }
 
+uint32
+UHoudiniAssetParameterString::GetEditorLayoutHash() const
+{
+    uint32 Hash = Super::GetEditorLayoutHash();
+    for ( const FString & Value : Values )
+        Hash = HashCombine( Hash, ::GetTypeHash( Value ) );
+
+    return Hash;
+}
+
 #endif
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -69,6 +69,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterString : public UHoudiniAss
 #if WITH_EDITOR
         /** Set value of this property through commit action, used by Slate. **/
         void SetValueCommitted( const FText & InValue, ETextCommit::Type CommitType, int32 Idx );
+
+        /** Text boxes are built from the values. **/
+        virtual uint32 GetEditorLayoutHash() const override;
 #endif
 
     protected:
@@ -27,6 +27,7 @@
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngine.h"
+#include "HoudiniParamUtils.h"
 
 #include "Misc/Variant.h"
 #include "Internationalization/Internationalization.h"
@@ -81,12 +82,8 @@ UHoudiniAssetParameterToggle::CreateParameter(
 
     // Get the actual value for this property.
     Values.SetNumZeroed( TupleSize );
-    if ( FHoudiniApi::GetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), InNodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::GetParmIntValues( InNodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
         return false;
-    }
 
     // Min and max make no sense for this type of parameter.
     return true;
@@ -98,12 +95,8 @@ UHoudiniAssetParameterToggle::UploadParameterValue()
     if (Values.Num() <= 0)
         return false;
 
-    if ( FHoudiniApi::SetParmIntValues(
-        FHoudiniEngine::Get().GetSession(), NodeId, &Values[ 0 ],
-        ValuesIndex, TupleSize ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniParamUtils::SetParmIntValues( NodeId, &Values[ 0 ], ValuesIndex, TupleSize ) )
         return false;
-    }
 
     return Super::UploadParameterValue();
 }
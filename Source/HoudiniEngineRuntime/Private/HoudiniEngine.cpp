@@ -37,6 +37,8 @@
 #include "HAL/PlatformMisc.h"
 #include "HAL/PlatformFilemanager.h"
 #include "Misc/ScopeLock.h"
+#include "Containers/Ticker.h"
+#include "Engine/Texture2D.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Materials/Material.h"
 
@@ -61,6 +63,9 @@ FHoudiniEngine::FHoudiniEngine()
     , HoudiniEngineScheduler( nullptr )
     , EnableCookingGlobal( true )
     , FirstSessionCreated( false )
+#if WITH_EDITOR
+    , LastDeferredTextureBuildTime( 0.0 )
+#endif
 {
     Session.type = HAPI_SESSION_MAX;
     Session.id = -1;
@@ -236,6 +241,10 @@ FHoudiniEngine::StartupModule()
         EnableCookingGlobal = !HoudiniRuntimeSettings->bPauseCookingOnStart;
     }
 
+    // Process the deferred builds of preview cook textures.
+    DeferredTextureBuildsTickerHandle = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw( this, &FHoudiniEngine::TickDeferredTextureBuilds ) );
+
 #endif
 
     // Store the instance.
@@ -269,6 +278,15 @@ FHoudiniEngine::ShutdownModule()
     }
 
 #if WITH_EDITOR
+    // Stop processing deferred texture builds.
+    if ( DeferredTextureBuildsTickerHandle.IsValid() )
+    {
+        FTicker::GetCoreTicker().RemoveTicker( DeferredTextureBuildsTickerHandle );
+        DeferredTextureBuildsTickerHandle.Reset();
+    }
+
+    DeferredTextureBuilds.Empty();
+
     // Unregister settings.
     ISettingsModule * SettingsModule = FModuleManager::GetModulePtr< ISettingsModule >( "Settings" );
     if ( SettingsModule )
@@ -679,4 +697,110 @@ FHoudiniEngine::GetFirstSessionCreated() const
     return FirstSessionCreated;
 }
 
+#if WITH_EDITOR
+
+void
+FHoudiniEngine::AddDeferredTextureBuild( UTexture2D * Texture )
+{
+    if ( !Texture || Texture->IsPendingKill() )
+        return;
+
+    LastDeferredTextureBuildTime = FPlatformTime::Seconds();
+
+    // A texture previewed again keeps the mip settings it had before its first preview.
+    for ( const FDeferredTextureBuild & DeferredTextureBuild : DeferredTextureBuilds )
+    {
+        if ( DeferredTextureBuild.Texture == Texture )
+            return;
+    }
+
+    FDeferredTextureBuild DeferredTextureBuild;
+    DeferredTextureBuild.Texture = Texture;
+    DeferredTextureBuild.MipGenSettings = Texture->MipGenSettings;
+    DeferredTextureBuilds.Add( DeferredTextureBuild );
+}
+
+bool
+FHoudiniEngine::RemoveDeferredTextureBuild( UTexture2D * Texture )
+{
+    for ( int32 Idx = 0; Idx < DeferredTextureBuilds.Num(); ++Idx )
+    {
+        if ( DeferredTextureBuilds[ Idx ].Texture != Texture )
+            continue;
+
+        if ( Texture && !Texture->IsPendingKill() )
+            Texture->MipGenSettings = DeferredTextureBuilds[ Idx ].MipGenSettings;
+
+        DeferredTextureBuilds.RemoveAt( Idx );
+        return true;
+    }
+
+    return false;
+}
+
+bool
+FHoudiniEngine::RestoreTextureBuildSettings( UTexture2D * Texture, UTexture2D * PreviewTexture )
+{
+    if ( !Texture || Texture->IsPendingKill() )
+        return false;
+
+    if ( !PreviewTexture )
+        PreviewTexture = Texture;
+
+    // Only a pending preview has its mip settings replaced, otherwise they are the user's.
+    bool bModified = false;
+    for ( const FDeferredTextureBuild & DeferredTextureBuild : DeferredTextureBuilds )
+    {
+        if ( DeferredTextureBuild.Texture != PreviewTexture )
+            continue;
+
+        if ( Texture->MipGenSettings != DeferredTextureBuild.MipGenSettings )
+        {
+            Texture->MipGenSettings = DeferredTextureBuild.MipGenSettings;
+            bModified = true;
+        }
+
+        break;
+    }
+
+    if ( Texture->DeferCompression )
+    {
+        Texture->DeferCompression = false;
+        bModified = true;
+    }
+
+    return bModified;
+}
+
+bool
+FHoudiniEngine::TickDeferredTextureBuilds( float DeltaTime )
+{
+    if ( DeferredTextureBuilds.Num() <= 0 )
+        return true;
+
+    // Textures are often replaced by the next cook, wait for cooking to settle.
+    if ( FPlatformTime::Seconds() - LastDeferredTextureBuildTime < HAPI_UNREAL_DEFERRED_TEXTURE_BUILD_DELAY )
+        return true;
+
+    // Build a single texture per tick to avoid stalling the editor.
+    while ( DeferredTextureBuilds.Num() > 0 )
+    {
+        UTexture2D * Texture = DeferredTextureBuilds[ 0 ].Texture.Get();
+        const bool bModified = RestoreTextureBuildSettings( Texture );
+        DeferredTextureBuilds.RemoveAt( 0 );
+
+        if ( bModified )
+        {
+            // The rebuilt texture differs from the preview that was cooked, it needs to be saved.
+            Texture->PostEditChange();
+            Texture->MarkPackageDirty();
+            break;
+        }
+    }
+
+    return true;
+}
+
+#endif
+
 #undef LOCTEXT_NAMESPACE
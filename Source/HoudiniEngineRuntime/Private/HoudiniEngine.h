@@ -26,8 +26,10 @@
 #include "IHoudiniEngine.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniRuntimeSettings.h"
+#include "Engine/TextureDefines.h"
 
 class UStaticMesh;
+class UTexture2D;
 class FRunnableThread;
 class FHoudiniEngineScheduler;
 
@@ -93,6 +95,22 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         bool RestartSession();
         bool InitializeHAPISession();
 
+#if WITH_EDITOR
+
+        /** Register a preview cook texture whose full build is deferred until cooking is idle. **/
+        /** Must be called before its preview settings are applied, its mip settings are kept.  **/
+        void AddDeferredTextureBuild( UTexture2D * Texture );
+
+        /** Remove a texture from the deferred builds, returns true if its build was still pending. **/
+        /** The mip settings the texture had before its preview are restored in that case.        **/
+        bool RemoveDeferredTextureBuild( UTexture2D * Texture );
+
+        /** Restore full quality build settings of a texture, using the settings recorded for the pending   **/
+        /** build of PreviewTexture (Texture itself if null). Returns true if they were modified.           **/
+        bool RestoreTextureBuildSettings( UTexture2D * Texture, UTexture2D * PreviewTexture = nullptr );
+
+#endif
+
     public:
 
         /** App identifier string. **/
@@ -111,6 +129,13 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Singleton instance of Houdini Engine. **/
         static FHoudiniEngine * HoudiniEngineInstance;
 
+#if WITH_EDITOR
+
+        /** Ticker processing one deferred texture build per tick once cooking is idle. **/
+        bool TickDeferredTextureBuilds( float DeltaTime );
+
+#endif
+
     private:
 
         /** Static mesh used for Houdini logo rendering. **/
@@ -127,6 +152,25 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Houdini logo brush. **/
         TSharedPtr< FSlateDynamicImageBrush > HoudiniLogoBrush;
 
+        /** Preview cook texture waiting for its full build. **/
+        struct FDeferredTextureBuild
+        {
+            /** Texture cooked as a preview. **/
+            TWeakObjectPtr< UTexture2D > Texture;
+
+            /** Mip settings of the texture before its preview. **/
+            TEnumAsByte< TextureMipGenSettings > MipGenSettings;
+        };
+
+        /** Preview cook textures waiting for their full build. **/
+        TArray< FDeferredTextureBuild > DeferredTextureBuilds;
+
+        /** Time of the last deferred texture build request. **/
+        double LastDeferredTextureBuildTime;
+
+        /** Handle of the deferred texture builds ticker. **/
+        FDelegateHandle DeferredTextureBuildsTickerHandle;
+
 #endif
 
         /** Synchronization primitive. **/
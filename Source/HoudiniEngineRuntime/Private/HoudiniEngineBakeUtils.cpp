@@ -58,11 +58,19 @@
     #include "InstancedFoliage.h"
     #include "InstancedFoliageActor.h"
     #include "Layers/LayersSubsystem.h"
+    #include "MeshDescription.h"
+    #include "StaticMeshAttributes.h"
 #endif
 #include "EngineUtils.h"
 #include "UObject/MetaData.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Hash/CityHash.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectHash.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 
 #if PLATFORM_WINDOWS
     #include "Windows/WindowsHWrapper.h"
@@ -190,6 +198,7 @@ FHoudiniEngineBakeUtils::BakeStaticMesh(
 
     // Notify registry that we created a new asset.
     FAssetRegistryModule::AssetCreated( StaticMesh );
+    FHoudiniScopedBakePackages::AddPackage( Package );
 
     // Copy materials.
     StaticMesh->StaticMaterials = InStaticMesh->StaticMaterials;
@@ -200,13 +209,16 @@ FHoudiniEngineBakeUtils::BakeStaticMesh(
 
     FStaticMeshSourceModel * SrcModel = &StaticMesh->GetSourceModel(0);
 
-    // Load raw data bytes.
-    FRawMesh RawMesh;
-    FStaticMeshSourceModel * InSrcModel = &InStaticMesh->GetSourceModel(0);
-    InSrcModel->LoadRawMesh( RawMesh );
+    // Copy the geometry of the first LOD.
+    FMeshDescription MeshDescription;
+    const FMeshDescription * InMeshDescription = InStaticMesh->GetMeshDescription( 0 );
+    if ( InMeshDescription )
+        MeshDescription = *InMeshDescription;
+    else
+        FStaticMeshAttributes( MeshDescription ).Register();
 
     // Some mesh generation settings.
-    HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel->BuildSettings, RawMesh );
+    HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel->BuildSettings, MeshDescription );
 
     // Setting the DistanceField resolution
     SrcModel->BuildSettings.DistanceFieldResolutionScale = HoudiniAssetComponent->GeneratedDistanceFieldResolutionScale;
@@ -216,7 +228,7 @@ FHoudiniEngineBakeUtils::BakeStaticMesh(
     if( SrcModel->BuildSettings.bGenerateLightmapUVs )
     {
         // See if we need to disable lightmap generation because of bad UVs.
-        if( FHoudiniEngineUtils::ContainsInvalidLightmapFaces( RawMesh, StaticMesh->LightMapCoordinateIndex ) )
+        if( FHoudiniEngineUtils::ContainsInvalidLightmapFaces( MeshDescription, StaticMesh->LightMapCoordinateIndex ) )
         {
             SrcModel->BuildSettings.bGenerateLightmapUVs = false;
 
@@ -227,9 +239,9 @@ FHoudiniEngineBakeUtils::BakeStaticMesh(
         }
     }
 
-    // Store the new raw mesh.
+    // Store the new geometry in the mesh description.
     SrcModel->StaticMeshOwner = StaticMesh;
-    SrcModel->SaveRawMesh( RawMesh );
+    FHoudiniEngineUtils::CommitMeshDescription( StaticMesh, 0, MoveTemp( MeshDescription ) );
 
     while (StaticMesh->GetNumSourceModels() < NumLODs)
         StaticMesh->AddSourceModel();
@@ -284,6 +296,9 @@ FHoudiniEngineBakeUtils::BakeBlueprint( UHoudiniAssetComponent * HoudiniAssetCom
 
 #if WITH_EDITOR
 
+    // Save all the packages of the bake together.
+    FHoudiniScopedBakePackages ScopedBakePackages;
+
     // Create package for our Blueprint.
     FString BlueprintName = TEXT( "" );
     UPackage * Package = FHoudiniEngineBakeUtils::BakeCreateBlueprintPackageForComponent(
@@ -304,7 +319,10 @@ FHoudiniEngineBakeUtils::BakeBlueprint( UHoudiniAssetComponent * HoudiniAssetCom
             Actor->ConditionalBeginDestroy();
 
             if( Blueprint && !Blueprint->IsPendingKill() )
+            {
                 FAssetRegistryModule::AssetCreated( Blueprint );
+                FHoudiniScopedBakePackages::AddPackage( Package );
+            }
         }
     }
 
@@ -323,6 +341,9 @@ FHoudiniEngineBakeUtils::ReplaceHoudiniActorWithBlueprint( UHoudiniAssetComponen
 
 #if WITH_EDITOR
 
+    // Save all the packages of the bake together.
+    FHoudiniScopedBakePackages ScopedBakePackages;
+
     // Create package for our Blueprint.
     FString BlueprintName = TEXT( "" );
     UPackage * Package = FHoudiniEngineBakeUtils::BakeCreateBlueprintPackageForComponent( HoudiniAssetComponent, BlueprintName );
@@ -388,6 +409,7 @@ FHoudiniEngineBakeUtils::ReplaceHoudiniActorWithBlueprint( UHoudiniAssetComponen
         // Compile our blueprint and notify asset system about blueprint.
         FKismetEditorUtilities::CompileBlueprint( Blueprint );
         FAssetRegistryModule::AssetCreated( Blueprint );
+        FHoudiniScopedBakePackages::AddPackage( Package );
 
         // Retrieve actor transform.
         FVector Location = ClonedActor->GetActorLocation();
@@ -435,47 +457,10 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
         else
             HoudiniCookParams.MaterialAndTextureBakeMode = BakeMode;
 
-        FString MeshName;
-        FGuid MeshGuid;
-
-        UPackage * MeshPackage = FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
-            HoudiniCookParams, HoudiniGeoPartObject, MeshName, MeshGuid );
-        if( !MeshPackage || MeshPackage->IsPendingKill() )
-            return nullptr;
-
-        // We need to be sure the package has been fully loaded before calling DuplicateObject
-        if (!MeshPackage->IsFullyLoaded())
-        {
-            FlushAsyncLoading();
-            if (!MeshPackage->GetOuter())
-            {
-                MeshPackage->FullyLoad();
-            }
-            else
-            {
-                MeshPackage->GetOutermost()->FullyLoad();
-            }
-        }
-
-        // Duplicate mesh for this new copied component.
-        DuplicatedStaticMesh = DuplicateObject< UStaticMesh >( StaticMesh, MeshPackage, *MeshName );
-        if ( !DuplicatedStaticMesh || DuplicatedStaticMesh->IsPendingKill() )
-            return nullptr;
-
-        if( BakeMode != EBakeMode::Intermediate )
-            DuplicatedStaticMesh->SetFlags( RF_Public | RF_Standalone );
-
-        // Add meta information.
-        FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
-            MeshPackage, DuplicatedStaticMesh,
-            HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT, TEXT( "true" ) );
-        FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
-            MeshPackage, DuplicatedStaticMesh,
-            HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *MeshName );
-
-        // See if we need to duplicate materials and textures.
+        // Bake the materials first, identical meshes are the ones referencing the same baked materials.
         TArray< FStaticMaterial > DuplicatedMaterials;
-        TArray< FStaticMaterial > & Materials = DuplicatedStaticMesh->StaticMaterials;
+        TMap< FString, FString > ReplacedPaths;
+        const TArray< FStaticMaterial > & Materials = StaticMesh->StaticMaterials;
 
         for( int32 MaterialIdx = 0; MaterialIdx < Materials.Num(); ++MaterialIdx )
         {
@@ -504,6 +489,7 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
                             FStaticMaterial DupeStaticMaterial = Materials[MaterialIdx];
                             DupeStaticMaterial.MaterialInterface = DuplicatedMaterial;
                             DuplicatedMaterials.Add( DupeStaticMaterial );
+                            ReplacedPaths.Add( Material->GetPathName(), DuplicatedMaterial->GetPathName() );
                             continue;
                         }
                     }
@@ -513,7 +499,25 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
             DuplicatedMaterials.Add( Materials[MaterialIdx] );
         }
 
-        /*
+        // Reference a mesh with the same content baked to the folder before, instead of creating a new one.
+        FString ContentHash;
+        if( BakeMode == EBakeMode::CreateNewAssets )
+        {
+            ContentHash = FHoudiniEngineBakeUtils::ComputeBakeContentHash( StaticMesh, ReplacedPaths );
+            UStaticMesh * BakedStaticMesh = Cast< UStaticMesh >( FHoudiniEngineBakeUtils::FindBakedAssetForContentHash(
+                HoudiniCookParams.BakeFolder.ToString(), StaticMesh, ContentHash ) );
+            if( BakedStaticMesh )
+                return BakedStaticMesh;
+        }
+
+        FString MeshName;
+        FGuid MeshGuid;
+
+        UPackage * MeshPackage = FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
+            HoudiniCookParams, HoudiniGeoPartObject, MeshName, MeshGuid, ContentHash );
+        if( !MeshPackage || MeshPackage->IsPendingKill() )
+            return nullptr;
+
         // We need to be sure the package has been fully loaded before calling DuplicateObject
         if (!MeshPackage->IsFullyLoaded())
         {
@@ -527,7 +531,29 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
                 MeshPackage->GetOutermost()->FullyLoad();
             }
         }
-        */
+
+        // Duplicate mesh for this new copied component.
+        DuplicatedStaticMesh = DuplicateObject< UStaticMesh >( StaticMesh, MeshPackage, *MeshName );
+        if ( !DuplicatedStaticMesh || DuplicatedStaticMesh->IsPendingKill() )
+            return nullptr;
+
+        if( BakeMode != EBakeMode::Intermediate )
+            DuplicatedStaticMesh->SetFlags( RF_Public | RF_Standalone );
+
+        // Add meta information.
+        FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+            MeshPackage, DuplicatedStaticMesh,
+            HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT, TEXT( "true" ) );
+        FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+            MeshPackage, DuplicatedStaticMesh,
+            HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *MeshName );
+
+        if( !ContentHash.IsEmpty() )
+        {
+            FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+                MeshPackage, DuplicatedStaticMesh,
+                HAPI_UNREAL_PACKAGE_META_GENERATED_CONTENT_HASH, *ContentHash );
+        }
 
         // Assign duplicated materials.
         DuplicatedStaticMesh->StaticMaterials = DuplicatedMaterials;
@@ -537,6 +563,7 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackage(
 
         // Dirty the static mesh package.
         DuplicatedStaticMesh->MarkPackageDirty();
+        FHoudiniScopedBakePackages::AddPackage( DuplicatedStaticMesh->GetOutermost() );
     }
 #endif
     return DuplicatedStaticMesh;
@@ -565,6 +592,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors( UHoudiniAssetComponent * Houd
         return bSuccess;
 
     const FScopedTransaction Transaction( LOCTEXT( "BakeToActors", "Bake To Actors" ) );
+    FHoudiniScopedBakePackages ScopedBakePackages;
 
     auto SMComponentToPart = HoudiniAssetComponent->CollectAllStaticMeshComponents();
     TArray< AActor* > NewActors = BakeHoudiniActorToActors_StaticMeshes( HoudiniAssetComponent, SMComponentToPart );
@@ -1000,6 +1028,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToOutlinerInput( UHoudiniAssetComponent
         return;
 
 #if WITH_EDITOR
+    FHoudiniScopedBakePackages ScopedBakePackages;
     TMap< const UStaticMesh*, UStaticMesh* > OriginalToBakedMesh;
     TMap< const UStaticMeshComponent*, FHoudiniGeoPartObject > SMComponentToPart = HoudiniAssetComponent->CollectAllStaticMeshComponents();
 
@@ -1091,6 +1120,7 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent * Houd
         return false;
 
     const FScopedTransaction Transaction(LOCTEXT("BakeToFoliage", "Bake To Foliage"));
+    FHoudiniScopedBakePackages ScopedBakePackages;
 
     ULevel* DesiredLevel = GWorld->GetCurrentLevel();
     AInstancedFoliageActor* InstancedFoliageActor = AInstancedFoliageActor::GetInstancedFoliageActorForLevel(DesiredLevel, true);
@@ -1100,6 +1130,11 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent * Houd
     // Map storing original and baked Static Meshes
     TMap< const UStaticMesh*, UStaticMesh* > OriginalToBakedMesh;
 
+    // FoliageType used for each mesh, and the instances to add to each FoliageType
+    TMap< UStaticMesh*, UFoliageType* > MeshToFoliageType;
+    TMap< UFoliageType*, TArray< FFoliageInstance > > FoliageTypeToInstances;
+    const FTransform HoudiniAssetTransform = HoudiniAssetComponent->GetComponentTransform();
+
     int32 BakedCount = 0;
     const TArray< UHoudiniAssetInstanceInputField * > InstanceInputFields = HoudiniAssetComponent->GetAllInstanceInputFields();
     for ( int32 Idx = 0; Idx < InstanceInputFields.Num(); ++Idx )
@@ -1131,44 +1166,90 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent * Houd
                 OutStaticMesh = OriginalToBakedMesh[ OutStaticMesh ];
             }
 
-            // See if we already have a FoliageType for that mesh
-            UFoliageType* FoliageType = InstancedFoliageActor->GetLocalFoliageTypeForSource(OutStaticMesh);            
-            if ( !FoliageType || FoliageType->IsPendingKill() )
+            // Reuse the FoliageType of that mesh, variations sharing a mesh are added together
+            UFoliageType* FoliageType = nullptr;
+            if ( UFoliageType** FoundFoliageType = MeshToFoliageType.Find( OutStaticMesh ) )
             {
-                // We need to create a new FoliageType for this Static Mesh
-                InstancedFoliageActor->AddMesh(OutStaticMesh, &FoliageType, HoudiniAssetComponent->GeneratedFoliageDefaultSettings);
+                FoliageType = *FoundFoliageType;
+            }
+            else
+            {
+                FoliageType = InstancedFoliageActor->GetLocalFoliageTypeForSource( OutStaticMesh );
+                if ( !FoliageType || FoliageType->IsPendingKill() )
+                {
+                    // We need to create a new FoliageType for this Static Mesh
+                    InstancedFoliageActor->AddMesh( OutStaticMesh, &FoliageType, HoudiniAssetComponent->GeneratedFoliageDefaultSettings );
+                }
+
+                MeshToFoliageType.Add( OutStaticMesh, FoliageType );
             }
 
-            // Get the FoliageMeshInfo for this Foliage type so we can add the instance to it
-            FFoliageInfo* FoliageInfo = InstancedFoliageActor->FindOrAddMesh(FoliageType);
-            if ( !FoliageInfo )
+            if ( !FoliageType || FoliageType->IsPendingKill() )
                 continue;
 
-            // Get the transforms for this instance
-            TArray< FTransform > ProcessedTransforms;
-            HoudiniAssetInstanceInputField->GetProcessedTransforms(ProcessedTransforms, VariationIdx);
-            FTransform HoudiniAssetTransform = HoudiniAssetComponent->GetComponentTransform();
+            // Compose the instances' transforms with the asset's, without copying them first
+            const TArray< FTransform > & InstancedTransforms = HoudiniAssetInstanceInputField->GetInstancedTransforms( VariationIdx );
+            TArray< FFoliageInstance > & FoliageInstances = FoliageTypeToInstances.FindOrAdd( FoliageType );
+            FoliageInstances.Reserve( FoliageInstances.Num() + InstancedTransforms.Num() );
 
             FFoliageInstance FoliageInstance;
-            for (auto CurrentTransform : ProcessedTransforms)
+            for ( const FTransform & InstancedTransform : InstancedTransforms )
             {
-                FoliageInstance.Location = HoudiniAssetTransform.TransformPosition(CurrentTransform.GetLocation());
-                FoliageInstance.Rotation = HoudiniAssetTransform.TransformRotation(CurrentTransform.GetRotation()).Rotator();
-                FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D() * HoudiniAssetTransform.GetScale3D();
+                FTransform CurrentTransform = InstancedTransform;
+                if ( !HoudiniAssetInstanceInputField->ProcessTransform( CurrentTransform, VariationIdx ) )
+                    continue;
 
-                FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
+                FoliageInstance.Location = HoudiniAssetTransform.TransformPosition( CurrentTransform.GetLocation() );
+                FoliageInstance.Rotation = HoudiniAssetTransform.TransformRotation( CurrentTransform.GetRotation() ).Rotator();
+                FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D() * HoudiniAssetTransform.GetScale3D();
+                FoliageInstances.Add( FoliageInstance );
             }
+        }
+    }
 
-            // TODO: This was due to a bug in UE4.22-20, check if still needed! 
-            if ( FoliageInfo->GetComponent() )
-                FoliageInfo->GetComponent()->BuildTreeIfOutdated(true, true);
+    // Add all the instances of each FoliageType at once: the foliage actor and component are only modified
+    // (and recorded in the transaction) once, and the component's tree is only rebuilt once.
+    for ( TPair< UFoliageType *, TArray< FFoliageInstance > > & Pair : FoliageTypeToInstances )
+    {
+        UFoliageType * FoliageType = Pair.Key;
+        const TArray< FFoliageInstance > & FoliageInstances = Pair.Value;
+        if ( FoliageInstances.Num() <= 0 )
+            continue;
 
-            // Notify the user that we succesfully bake the instances to foliage
-            FString Notification = TEXT("Successfully baked ") + FString::FromInt(ProcessedTransforms.Num()) + TEXT(" instances of ") + OutStaticMesh->GetName() + TEXT(" to Foliage");
-            FHoudiniEngineUtils::CreateSlateNotification(Notification);
+        // Get the FoliageMeshInfo for this Foliage type so we can add the instances to it
+        FFoliageInfo* FoliageInfo = InstancedFoliageActor->FindOrAddMesh( FoliageType );
+        if ( !FoliageInfo )
+            continue;
+
+        UHierarchicalInstancedStaticMeshComponent * FoliageComponent = FoliageInfo->GetComponent();
+        const bool bAutoRebuildTree = FoliageComponent ? FoliageComponent->bAutoRebuildTreeOnInstanceChanges : true;
+        if ( FoliageComponent )
+            FoliageComponent->bAutoRebuildTreeOnInstanceChanges = false;
+
+        TArray< const FFoliageInstance * > NewInstances;
+        NewInstances.Reserve( FoliageInstances.Num() );
+        for ( const FFoliageInstance & FoliageInstance : FoliageInstances )
+            NewInstances.Add( &FoliageInstance );
 
-            BakedCount += ProcessedTransforms.Num();
+        FoliageInfo->AddInstances( InstancedFoliageActor, FoliageType, NewInstances );
+
+        // TODO: This was due to a bug in UE4.22-20, check if still needed! 
+        FoliageComponent = FoliageInfo->GetComponent();
+        if ( FoliageComponent )
+        {
+            FoliageComponent->bAutoRebuildTreeOnInstanceChanges = bAutoRebuildTree;
+            FoliageComponent->BuildTreeIfOutdated( true, true );
         }
+
+        BakedCount += FoliageInstances.Num();
+    }
+
+    // Notify the user that we succesfully bake the instances to foliage
+    if ( BakedCount > 0 )
+    {
+        FString Notification = TEXT("Successfully baked ") + FString::FromInt( BakedCount ) + TEXT(" instances of ")
+            + FString::FromInt( FoliageTypeToInstances.Num() ) + TEXT(" meshes to Foliage");
+        FHoudiniEngineUtils::CreateSlateNotification( Notification );
     }
 
     if (BakedCount > 0)
@@ -1210,10 +1291,36 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 {
     UMaterial * DuplicatedMaterial = nullptr;
 #if WITH_EDITOR
+    // Reference a material with the same content baked to the folder before, instead of creating a new one.
+    // Generated textures are identified by their content hash, as they are baked or reused from it.
+    FString ContentHash;
+    if( HoudiniCookParams.MaterialAndTextureBakeMode == EBakeMode::CreateNewAssets )
+    {
+        TMap< FString, FString > ReplacedPaths;
+        for( UMaterialExpression * Expression : Material->Expressions )
+        {
+            UMaterialExpressionTextureSample * TextureSample = Cast< UMaterialExpressionTextureSample >( Expression );
+            UTexture2D * Texture = TextureSample ? Cast< UTexture2D >( TextureSample->Texture ) : nullptr;
+            if( !Texture || Texture->IsPendingKill() )
+                continue;
+
+            UMetaData * MetaData = Texture->GetOutermost()->GetMetaData();
+            const FString TextureHash = MetaData ? MetaData->GetValue( Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH ) : FString();
+            if( !TextureHash.IsEmpty() )
+                ReplacedPaths.Add( Texture->GetPathName(), TextureHash );
+        }
+
+        ContentHash = FHoudiniEngineBakeUtils::ComputeBakeContentHash( Material, ReplacedPaths );
+        UMaterial * BakedMaterial = Cast< UMaterial >( FHoudiniEngineBakeUtils::FindBakedAssetForContentHash(
+            HoudiniCookParams.BakeFolder.ToString(), Material, ContentHash ) );
+        if( BakedMaterial )
+            return BakedMaterial;
+    }
+
     // Create material package.
     FString MaterialName;
     UPackage * MaterialPackage = FHoudiniEngineBakeUtils::BakeCreateTextureOrMaterialPackageForComponent(
-        HoudiniCookParams, SubMaterialName, MaterialName );
+        HoudiniCookParams, SubMaterialName, MaterialName, ContentHash );
 
     if( !MaterialPackage || MaterialPackage->IsPendingKill() )
         return nullptr;
@@ -1234,6 +1341,13 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
         MaterialPackage, DuplicatedMaterial,
         HAPI_UNREAL_PACKAGE_META_GENERATED_NAME, *MaterialName );
 
+    if( !ContentHash.IsEmpty() )
+    {
+        FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+            MaterialPackage, DuplicatedMaterial,
+            HAPI_UNREAL_PACKAGE_META_GENERATED_CONTENT_HASH, *ContentHash );
+    }
+
     // Retrieve and check various sampling expressions. If they contain textures, duplicate (and bake) them.
 
     for( auto& Expression : DuplicatedMaterial->Expressions )
@@ -1247,6 +1361,7 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 
     // Dirty the material package.
     DuplicatedMaterial->MarkPackageDirty();
+    FHoudiniScopedBakePackages::AddPackage( DuplicatedMaterial->GetOutermost() );
 
     // Reset any derived state
     DuplicatedMaterial->ForceRecompileForRendering();
@@ -1307,10 +1422,16 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
         const FString & TextureType =
             MetaData->GetValue( Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE );
 
+        // Reuse the texture already baked for identical content, materials sharing a plane share the baked texture.
+        const FString TextureHash = MetaData->GetValue( Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH );
+        UTexture2D * BakedTexture = FHoudiniEngineBakeUtils::FindBakedTextureForHash( HoudiniCookParams, Texture, TextureHash );
+        if ( BakedTexture )
+            return BakedTexture;
+
         // Create texture package.
         FString TextureName;
         UPackage * NewTexturePackage = FHoudiniEngineBakeUtils::BakeCreateTextureOrMaterialPackageForComponent(
-            HoudiniCookParams, SubTextureName, TextureName );
+            HoudiniCookParams, SubTextureName, TextureName, TextureHash );
 
         if( !NewTexturePackage || NewTexturePackage->IsPendingKill() )
             return nullptr;
@@ -1323,6 +1444,10 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
         if( HoudiniCookParams.MaterialAndTextureBakeMode != EBakeMode::Intermediate )
             DuplicatedTexture->SetFlags( RF_Public | RF_Standalone );
 
+        // Baked textures are always fully built and compressed, even if the cooked one was a preview.
+        if ( FHoudiniEngine::Get().RestoreTextureBuildSettings( DuplicatedTexture, Texture ) )
+            DuplicatedTexture->PostEditChange();
+
         // Add meta information.
         FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
             NewTexturePackage, DuplicatedTexture,
@@ -1334,16 +1459,71 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
             NewTexturePackage, DuplicatedTexture,
             HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE, *TextureType );
 
+        // Keep the content hash so the baked texture can be matched against newly extracted images.
+        if ( !TextureHash.IsEmpty() )
+        {
+            FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+                NewTexturePackage, DuplicatedTexture,
+                HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH, *TextureHash );
+
+            if ( HoudiniCookParams.BakedTexturesForHashes )
+                HoudiniCookParams.BakedTexturesForHashes->Add( TextureHash, DuplicatedTexture );
+        }
+
         // Notify registry that we have created a new duplicate texture.
         FAssetRegistryModule::AssetCreated( DuplicatedTexture );
 
         // Dirty the texture package.
         DuplicatedTexture->MarkPackageDirty();
+        FHoudiniScopedBakePackages::AddPackage( DuplicatedTexture->GetOutermost() );
     }
 #endif
     return DuplicatedTexture;
 }
 
+UTexture2D *
+FHoudiniEngineBakeUtils::FindBakedTextureForHash(
+    FHoudiniCookParams& HoudiniCookParams, const UTexture2D * Texture, const FString & TextureHash )
+{
+#if WITH_EDITOR
+    if ( TextureHash.IsEmpty() || !HoudiniCookParams.BakedTexturesForHashes )
+        return nullptr;
+
+    // Intermediate textures live in the level, they can't be shared.
+    EBakeMode BakeMode = HoudiniCookParams.MaterialAndTextureBakeMode;
+    if ( BakeMode == EBakeMode::Intermediate )
+        return nullptr;
+
+    // Textures baked by other components, or by earlier bakes, are only shared when creating new assets.
+    TWeakObjectPtr< UTexture2D > * FoundPointer = HoudiniCookParams.BakedTexturesForHashes->Find( TextureHash );
+    if ( !FoundPointer )
+    {
+        if ( BakeMode != EBakeMode::CreateNewAssets )
+            return nullptr;
+
+        return Cast< UTexture2D >( FHoudiniEngineBakeUtils::FindBakedAssetForContentHash(
+            HoudiniCookParams.BakeFolder.ToString(), Texture, TextureHash ) );
+    }
+
+    UTexture2D * BakedTexture = FoundPointer->Get();
+    if ( !BakedTexture || BakedTexture->IsPendingKill() )
+    {
+        HoudiniCookParams.BakedTexturesForHashes->Remove( TextureHash );
+        return nullptr;
+    }
+
+    // Only reuse textures located in the folder we are currently baking to.
+    const FString & Folder = ( BakeMode == EBakeMode::CookToTemp )
+        ? HoudiniCookParams.TempCookFolder.ToString() : HoudiniCookParams.BakeFolder.ToString();
+    if ( !BakedTexture->GetOutermost()->GetName().StartsWith( UPackageTools::SanitizePackageName( Folder ) ) )
+        return nullptr;
+
+    return BakedTexture;
+#else
+    return nullptr;
+#endif
+}
+
 FHoudiniCookParams::FHoudiniCookParams( UHoudiniAssetComponent* HoudiniAssetComponent )
 {
 #if WITH_EDITOR
@@ -1352,6 +1532,7 @@ FHoudiniCookParams::FHoudiniCookParams( UHoudiniAssetComponent* HoudiniAssetComp
     PackageGUID = HoudiniAssetComponent->GetComponentGuid();
     BakedStaticMeshPackagesForParts = &HoudiniAssetComponent->BakedStaticMeshPackagesForParts;
     BakedMaterialPackagesForIds = &HoudiniAssetComponent->BakedMaterialPackagesForIds;
+    BakedTexturesForHashes = &HoudiniAssetComponent->BakedTexturesForHashes;
     CookedTemporaryStaticMeshPackages = &HoudiniAssetComponent->CookedTemporaryStaticMeshPackages;
     CookedTemporaryPackages = &HoudiniAssetComponent->CookedTemporaryPackages;
     CookedTemporaryLandscapeLayers = &HoudiniAssetComponent->CookedTemporaryLandscapeLayers;
@@ -1479,7 +1660,8 @@ UPackage *
 FHoudiniEngineBakeUtils::BakeCreateTextureOrMaterialPackageForComponent(
     FHoudiniCookParams& HoudiniCookParams,
     const FString & MaterialInfoDescriptor,
-    FString & MaterialName )
+    FString & MaterialName,
+    const FString & ContentHash )
 {
     UPackage * PackageNew = nullptr;
 
@@ -1566,17 +1748,29 @@ FHoudiniEngineBakeUtils::BakeCreateTextureOrMaterialPackageForComponent(
         }
     }
 
+    // New assets are named after their content hash, so they can be found by name without being loaded.
+    // A guid is only added if another asset already uses that name.
+    const bool bNameWithContentHash = ( BakeMode == EBakeMode::CreateNewAssets ) && !ContentHash.IsEmpty();
+    bool bNeedsGUID = !bNameWithContentHash;
+
     while ( true )
     {
-        if ( !BakeGUID.IsValid() )
-            BakeGUID = FGuid::NewGuid();
-
-        // We only want half of generated guid string.
-        FString BakeGUIDString = BakeGUID.ToString().Left( FHoudiniEngineUtils::PackageGUIDItemNameLength );
-
         // Generate material name.
         MaterialName = MaterialInfoDescriptor;
-        MaterialName += BakeGUIDString;
+        if ( bNameWithContentHash )
+            MaterialName += ContentHash;
+
+        if ( bNeedsGUID )
+        {
+            if ( !BakeGUID.IsValid() )
+                BakeGUID = FGuid::NewGuid();
+
+            // We only want half of generated guid string.
+            FString BakeGUIDString = BakeGUID.ToString().Left( FHoudiniEngineUtils::PackageGUIDItemNameLength );
+            if ( bNameWithContentHash )
+                MaterialName += TEXT( "_" );
+            MaterialName += BakeGUIDString;
+        }
 
         switch (BakeMode)
         {
@@ -1624,6 +1818,7 @@ FHoudiniEngineBakeUtils::BakeCreateTextureOrMaterialPackageForComponent(
         {
             // Package does exist, there's a collision, we need to generate a new name.
             BakeGUID.Invalidate();
+            bNeedsGUID = true;
         }
         else
         {
@@ -1647,6 +1842,200 @@ FHoudiniEngineBakeUtils::BakeCreateTextureOrMaterialPackageForComponent(
     return PackageNew;
 }
 
+#if WITH_EDITOR
+/** Whether a baked asset found by content hash has the same content as Object, so a hash collision isn't reused. **/
+static bool
+IsBakedAssetContentEqual( const UObject * BakedAsset, const UObject * Object )
+{
+    if ( BakedAsset->GetClass() != Object->GetClass() )
+        return false;
+
+    const UStaticMesh * BakedStaticMesh = Cast< UStaticMesh >( BakedAsset );
+    const UStaticMesh * StaticMesh = Cast< UStaticMesh >( Object );
+    if ( BakedStaticMesh && StaticMesh )
+    {
+        if ( BakedStaticMesh->GetNumSourceModels() != StaticMesh->GetNumSourceModels() )
+            return false;
+
+        for ( int32 LODIdx = 0; LODIdx < StaticMesh->GetNumSourceModels(); ++LODIdx )
+        {
+            FMeshDescription * BakedMeshDescription = BakedStaticMesh->GetMeshDescription( LODIdx );
+            FMeshDescription * MeshDescription = StaticMesh->GetMeshDescription( LODIdx );
+            if ( !BakedMeshDescription || !MeshDescription )
+            {
+                if ( BakedMeshDescription != MeshDescription )
+                    return false;
+
+                continue;
+            }
+
+            if ( BakedMeshDescription->Vertices().Num() != MeshDescription->Vertices().Num()
+                || BakedMeshDescription->VertexInstances().Num() != MeshDescription->VertexInstances().Num()
+                || BakedMeshDescription->Polygons().Num() != MeshDescription->Polygons().Num()
+                || BakedMeshDescription->PolygonGroups().Num() != MeshDescription->PolygonGroups().Num() )
+                return false;
+
+            // Same counts, compare the geometry itself.
+            TArray< uint8 > BakedBytes;
+            FMemoryWriter BakedWriter( BakedBytes );
+            BakedWriter << *BakedMeshDescription;
+
+            TArray< uint8 > Bytes;
+            FMemoryWriter Writer( Bytes );
+            Writer << *MeshDescription;
+
+            if ( BakedBytes != Bytes )
+                return false;
+        }
+
+        return true;
+    }
+
+    const UTexture2D * BakedTexture = Cast< UTexture2D >( BakedAsset );
+    const UTexture2D * Texture = Cast< UTexture2D >( Object );
+    if ( BakedTexture && Texture )
+    {
+        return BakedTexture->Source.GetSizeX() == Texture->Source.GetSizeX()
+            && BakedTexture->Source.GetSizeY() == Texture->Source.GetSizeY()
+            && BakedTexture->Source.GetFormat() == Texture->Source.GetFormat();
+    }
+
+    const UMaterial * BakedMaterial = Cast< UMaterial >( BakedAsset );
+    const UMaterial * Material = Cast< UMaterial >( Object );
+    if ( BakedMaterial && Material )
+        return BakedMaterial->Expressions.Num() == Material->Expressions.Num();
+
+    return true;
+}
+#endif
+
+FString
+FHoudiniEngineBakeUtils::ComputeBakeContentHash( const UObject * Object, const TMap< FString, FString > & ReplacedPaths )
+{
+    if ( !Object || Object->IsPendingKill() )
+        return FString();
+
+#if WITH_EDITOR
+    // The object and its subobjects are hashed relative to the object, so its name and package don't matter.
+    const FString ObjectPathName = Object->GetPathName();
+    const FString PackageName = Object->GetOutermost()->GetName();
+
+    TArray< UObject * > SubObjects;
+    GetObjectsWithOuter( Object, SubObjects, true );
+    SubObjects.Sort( []( const UObject & A, const UObject & B ) { return A.GetPathName() < B.GetPathName(); } );
+    SubObjects.Insert( const_cast< UObject * >( Object ), 0 );
+
+    uint64 Hash = 0;
+    auto HashString = [ &Hash ]( const FString & String )
+    {
+        Hash = CityHash64WithSeed( (const char *) *String, String.Len() * sizeof( TCHAR ), Hash );
+    };
+
+    for ( const UObject * SubObject : SubObjects )
+    {
+        if ( !SubObject || SubObject->IsPendingKill() )
+            continue;
+
+        HashString( SubObject->GetClass()->GetPathName() );
+        HashString( SubObject->GetPathName().Replace( *ObjectPathName, TEXT( "" ) ) );
+
+        for ( TFieldIterator< UProperty > PropIt( SubObject->GetClass() ); PropIt; ++PropIt )
+        {
+            const UProperty * Property = *PropIt;
+            if ( Property->HasAnyPropertyFlags( CPF_Transient | CPF_DuplicateTransient | CPF_NonPIEDuplicateTransient | CPF_Deprecated ) )
+                continue;
+
+            // Guids are regenerated for each copy.
+            const UStructProperty * StructProperty = Cast< UStructProperty >( Property );
+            const UArrayProperty * ArrayProperty = Cast< UArrayProperty >( Property );
+            if ( ArrayProperty )
+                StructProperty = Cast< UStructProperty >( ArrayProperty->Inner );
+            if ( StructProperty && StructProperty->Struct == TBaseStructure< FGuid >::Get() )
+                continue;
+
+            for ( int32 ArrayIdx = 0; ArrayIdx < Property->ArrayDim; ++ArrayIdx )
+            {
+                FString Value;
+                Property->ExportText_InContainer( ArrayIdx, Value, SubObject, nullptr, nullptr, PPF_None );
+
+                Value.ReplaceInline( *ObjectPathName, TEXT( "" ) );
+                for ( const TPair< FString, FString > & ReplacedPath : ReplacedPaths )
+                    Value.ReplaceInline( *ReplacedPath.Key, *ReplacedPath.Value );
+                Value.ReplaceInline( *PackageName, TEXT( "" ) );
+
+                HashString( Property->GetName() );
+                HashString( Value );
+            }
+        }
+    }
+
+    // The geometry of static meshes isn't stored in properties.
+    const UStaticMesh * StaticMesh = Cast< UStaticMesh >( Object );
+    if ( StaticMesh )
+    {
+        for ( int32 LODIdx = 0; LODIdx < StaticMesh->GetNumSourceModels(); ++LODIdx )
+        {
+            FMeshDescription * MeshDescription = StaticMesh->GetMeshDescription( LODIdx );
+            if ( !MeshDescription )
+                continue;
+
+            TArray< uint8 > Bytes;
+            FMemoryWriter Writer( Bytes );
+            Writer << *MeshDescription;
+            Hash = CityHash64WithSeed( (const char *) Bytes.GetData(), Bytes.Num(), Hash );
+        }
+    }
+
+    return FString::Printf( TEXT( "%016llx" ), Hash );
+#else
+    return FString();
+#endif
+}
+
+UObject *
+FHoudiniEngineBakeUtils::FindBakedAssetForContentHash(
+    const FString & BakeFolder, const UObject * Object, const FString & ContentHash )
+{
+#if WITH_EDITOR
+    if ( ContentHash.IsEmpty() || !Object || Object->IsPendingKill() )
+        return nullptr;
+
+    const FString PackageFolder = UPackageTools::SanitizePackageName( BakeFolder );
+    const FName ClassName = Object->GetClass()->GetFName();
+
+    // Assets are baked with their content hash in their name, so candidates are found from the registry's data
+    // without loading every asset in the folder.
+    FAssetRegistryModule & AssetRegistryModule = FModuleManager::LoadModuleChecked< FAssetRegistryModule >( "AssetRegistry" );
+    TArray< FAssetData > AssetDatas;
+    AssetRegistryModule.Get().GetAssetsByPath( FName( *PackageFolder ), AssetDatas, false );
+
+    for ( const FAssetData & AssetData : AssetDatas )
+    {
+        if ( AssetData.AssetClass != ClassName || !AssetData.AssetName.ToString().Contains( ContentHash ) )
+            continue;
+
+        UObject * Asset = AssetData.GetAsset();
+        if ( !Asset || Asset->IsPendingKill() )
+            continue;
+
+        UMetaData * MetaData = Asset->GetOutermost()->GetMetaData();
+        if ( !MetaData || MetaData->IsPendingKill() )
+            continue;
+
+        FString AssetHash = MetaData->GetValue( Asset, HAPI_UNREAL_PACKAGE_META_GENERATED_CONTENT_HASH );
+        if ( AssetHash.IsEmpty() )
+            AssetHash = MetaData->GetValue( Asset, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH );
+
+        if ( AssetHash == ContentHash && IsBakedAssetContentEqual( Asset, Object ) )
+            return Asset;
+    }
+
+    return nullptr;
+#else
+    return nullptr;
+#endif
+}
+
 bool 
 FHoudiniEngineBakeUtils::CheckPackageSafeForBake( UPackage* Package, FString& FoundAssetName )
 {
@@ -1681,7 +2070,7 @@ UPackage *
 FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
     FHoudiniCookParams& HoudiniCookParams,
     const FHoudiniGeoPartObject & HoudiniGeoPartObject,
-    FString & MeshName, FGuid & BakeGUID )
+    FString & MeshName, FGuid & BakeGUID, const FString & ContentHash )
 {
     UPackage * PackageNew = nullptr;
 
@@ -1774,6 +2163,12 @@ FHoudiniEngineBakeUtils::BakeCreateStaticMeshPackageForComponent(
 
         MeshName = HoudiniCookParams.HoudiniCookManager->GetBakingBaseName( HoudiniGeoPartObject );
 
+        // New meshes are named after their content hash, so they can be found by name without being loaded.
+        if( ( BakeMode == EBakeMode::CreateNewAssets ) && !ContentHash.IsEmpty() )
+        {
+            MeshName += TEXT( "_" ) + ContentHash;
+        }
+
         if( BakeCount > 0 )
         {
             MeshName += FString::Printf( TEXT( "_%02d" ), BakeCount );
@@ -1934,4 +2329,96 @@ FHoudiniEngineBakeUtils::DeleteBakedHoudiniAssetActor(UHoudiniAssetComponent * H
 #endif
 
     return bSuccess;
-}
\ No newline at end of file
+}
+
+int32
+FHoudiniEngineBakeUtils::SaveBakedPackages( const TArray< UPackage * > & Packages, TArray< FString > & FailedPackageNames )
+{
+    int32 SavedCount = 0;
+
+#if WITH_EDITOR
+    FScopedSlowTask SlowTask( (float) Packages.Num(), LOCTEXT( "SavingBakedPackages", "Saving baked packages" ) );
+
+    for ( UPackage * Package : Packages )
+    {
+        SlowTask.EnterProgressFrame();
+        if ( !Package || Package->IsPendingKill() )
+            continue;
+
+        if ( !Package->IsFullyLoaded() )
+            Package->FullyLoad();
+
+        // Packages are serialized here, on the game thread, only their file writes are queued on worker threads.
+        const FString PackageFileName = FPackageName::LongPackageNameToFilename(
+            Package->GetName(), FPackageName::GetAssetPackageExtension() );
+        if ( UPackage::SavePackage(
+            Package, nullptr, RF_Public | RF_Standalone, *PackageFileName,
+            GError, nullptr, false, true, SAVE_NoError | SAVE_Async ) )
+        {
+            SavedCount++;
+        }
+        else
+        {
+            FailedPackageNames.Add( Package->GetName() );
+        }
+    }
+
+    // Wait once for all the writes.
+    UPackage::WaitForAsyncFileWrites();
+#endif
+
+    return SavedCount;
+}
+
+int32 FHoudiniScopedBakePackages::ScopeCount = 0;
+TArray< TWeakObjectPtr< UPackage > > FHoudiniScopedBakePackages::Packages;
+
+FHoudiniScopedBakePackages::FHoudiniScopedBakePackages()
+{
+    check( IsInGameThread() );
+    ScopeCount++;
+}
+
+FHoudiniScopedBakePackages::~FHoudiniScopedBakePackages()
+{
+    check( IsInGameThread() );
+    if ( --ScopeCount > 0 )
+        return;
+
+    TArray< UPackage * > PackagesToSave;
+    for ( const TWeakObjectPtr< UPackage > & Package : Packages )
+    {
+        if ( Package.IsValid() )
+            PackagesToSave.Add( Package.Get() );
+    }
+    Packages.Empty();
+
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( PackagesToSave.Num() <= 0 || !HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bSaveBakedPackages )
+        return;
+
+    const double StartTime = FPlatformTime::Seconds();
+    TArray< FString > FailedPackageNames;
+    const int32 SavedCount = FHoudiniEngineBakeUtils::SaveBakedPackages( PackagesToSave, FailedPackageNames );
+
+    for ( const FString & FailedPackageName : FailedPackageNames )
+        HOUDINI_LOG_WARNING( TEXT( "Bake: could not save package %s." ), *FailedPackageName );
+
+    FString Notification = FString::Printf(
+        TEXT( "Saved %d baked packages in %.2f s." ), SavedCount, FPlatformTime::Seconds() - StartTime );
+    if ( FailedPackageNames.Num() > 0 )
+        Notification += FString::Printf( TEXT( " %d packages could not be saved." ), FailedPackageNames.Num() );
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Bake: %s" ), *Notification );
+    FHoudiniEngineUtils::CreateSlateNotification( Notification );
+}
+
+void
+FHoudiniScopedBakePackages::AddPackage( UPackage * Package )
+{
+    check( IsInGameThread() );
+    if ( ScopeCount <= 0 || !Package || Package->IsPendingKill() )
+        return;
+
+    Packages.AddUnique( Package );
+}
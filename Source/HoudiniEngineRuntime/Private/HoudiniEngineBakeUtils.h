@@ -164,18 +164,42 @@ public:
         const FString & TextureType,
         FString & TextureName );
 
-    /** Create a package for a given component for either a texture or material **/
+    /** Create a package for a given component for either a texture or material. When creating new assets, the **/
+    /** content hash, if any, is used in the name instead of a guid so the asset can be found by it.               **/
     static UPackage * BakeCreateTextureOrMaterialPackageForComponent(
         FHoudiniCookParams& HoudiniCookParams,
         const FString & MaterialInfoDescriptor, 
-        FString & MaterialName );
+        FString & MaterialName,
+        const FString & ContentHash = FString() );
 
-    /** Create a package for given component for static mesh baking. **/
+    /** Create a package for given component for static mesh baking. When creating new assets, the content hash, **/
+    /** if any, is appended to the name so the mesh can be found by it.                                          **/
     static UPackage * BakeCreateStaticMeshPackageForComponent(
         FHoudiniCookParams& HoudiniCookParams,
         const FHoudiniGeoPartObject & HoudiniGeoPartObject,
         FString & MeshName,
-        FGuid & BakeGUID );
+        FGuid & BakeGUID,
+        const FString & ContentHash = FString() );
+
+    /** Return a texture with the same content as Texture already baked in the current bake folder, if any. **/
+    static UTexture2D * FindBakedTextureForHash(
+        FHoudiniCookParams& HoudiniCookParams,
+        const UTexture2D * Texture,
+        const FString & TextureHash );
+
+    /** Compute a hash of an object's content: its properties and its subobjects' properties, guids and transient **/
+    /** data excluded. References to other objects are hashed by path, after applying ReplacedPaths. Static meshes **/
+    /** also hash the mesh description of each source model.                                                       **/
+    static FString ComputeBakeContentHash(
+        const UObject * Object,
+        const TMap< FString, FString > & ReplacedPaths );
+
+    /** Return an asset baked to the folder with the content hash in its name and the same content as Object, if **/
+    /** any. Candidates are matched by name and class in the asset registry, only a matching one is loaded.      **/
+    static UObject * FindBakedAssetForContentHash(
+        const FString & BakeFolder,
+        const UObject * Object,
+        const FString & ContentHash );
 
     /** Checks the package is not referenced or marked for garbage collection **/
     static bool CheckPackageSafeForBake( 
@@ -197,4 +221,26 @@ public:
     /** Used by the replace function to delete the Houdini Asset Actor after it's been baked */
     static bool DeleteBakedHoudiniAssetActor(
         UHoudiniAssetComponent * HoudiniAssetComponent);
+
+    /** Save the given packages, with asynchronous file writes, and wait for all of them once. Returns the number **/
+    /** of packages saved, the names of the packages that could not be saved are added to FailedPackageNames.    **/
+    static int32 SaveBakedPackages(
+        const TArray< UPackage * > & Packages,
+        TArray< FString > & FailedPackageNames );
+};
+
+/** While in scope, the packages created by bakes are collected and are all saved together when the outermost scope **/
+/** ends, with a single consolidated report, instead of being left dirty one by one.                               **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedBakePackages
+{
+    FHoudiniScopedBakePackages();
+    ~FHoudiniScopedBakePackages();
+
+    /** Collect a baked package, does nothing if no scope is active. **/
+    static void AddPackage( UPackage * Package );
+
+    private:
+
+        static int32 ScopeCount;
+        static TArray< TWeakObjectPtr< UPackage > > Packages;
 };
\ No newline at end of file
@@ -27,12 +27,20 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineBakeUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
 #include "CoreMinimal.h"
 #include "Engine/StaticMesh.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/FileManagerGeneric.h"
+#include "Misc/FileHelper.h"
+#include "Misc/SecureHash.h"
+#include "Async/ParallelFor.h"
+#if WITH_EDITOR
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#endif
 
 
 const FString LocalAutoBakeFolder = TEXT("/HoudiniEngine/AutoBake/");
@@ -76,10 +84,11 @@ int32 UHoudiniEngineConvertBgeoCommandlet::Main( const FString& Params )
     FString BGEOFilePath = ArgumentsArray[ 1 ];
     FString UASSETFilePath = ArgumentsArray.Num() > 2 ? ArgumentsArray[ 2 ] : FString();
 
-    if ( !FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( BGEOFilePath, UASSETFilePath ) )
-        return 1;
+    const bool bSuccess = FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( BGEOFilePath, UASSETFilePath );
 
-    return 0;
+    FHoudiniCommandletUtils::ReleaseAllBGEOInputNodesInHAPI();
+
+    return bSuccess ? 0 : 1;
 }
 
 UHoudiniEngineConvertBgeoDirCommandlet::UHoudiniEngineConvertBgeoDirCommandlet()
@@ -90,14 +99,45 @@ UHoudiniEngineConvertBgeoDirCommandlet::UHoudiniEngineConvertBgeoDirCommandlet()
     LogToConsole = true;
 }
 
+/** Pending .bgeo files of the directory converter, fed by directory change notifications. **/
+struct FHoudiniBgeoConversionQueue
+{
+    /** Time to wait after the last change of a file before converting it, so it is fully written. **/
+    static constexpr double SettleTime = 0.5;
+
+    /** File names waiting for conversion, with the time of their last change. **/
+    TMap< FString, double > PendingFiles;
+
+    void Enqueue( const FString& FileName )
+    {
+        PendingFiles.Add( FileName, FPlatformTime::Seconds() );
+    }
+
+    /** Removes and returns up to MaxCount files that have not changed for SettleTime. **/
+    void DequeueSettledFiles( int32 MaxCount, TArray< FString >& OutFileNames )
+    {
+        const double Now = FPlatformTime::Seconds();
+        for ( TMap< FString, double >::TIterator Iter( PendingFiles ); Iter && OutFileNames.Num() < MaxCount; ++Iter )
+        {
+            if ( Now - Iter.Value() < SettleTime )
+                continue;
+
+            OutFileNames.Add( Iter.Key() );
+            Iter.RemoveCurrent();
+        }
+    }
+};
+
 int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
 {
-    // Run me via UE4editor.exe my.uproject -run=HoudiniEngineConvertBgeoDir BGEO_DIR_IN (UASSET_DIR_OUT)
+#if WITH_EDITOR
+    // Run me via UE4editor.exe my.uproject -run=HoudiniEngineConvertBgeoDir BGEO_DIR_IN (UASSET_DIR_OUT) (TIMEOUT) (-jobs=N)
     HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Convert BGEO directory"));
 
-    // Parse the params to a string arrays
+    // Parse the params to a string arrays, switches are handled separately
     TArray<FString> ArgumentsArray;
     Params.ParseIntoArray(ArgumentsArray, TEXT(" "), true);
+    ArgumentsArray.RemoveAll( []( const FString& Argument ) { return Argument.StartsWith( TEXT( "-" ) ); } );
 
     // We're expecting at least one param (the bgeo dir in) and a maximum of 3 params (bgeo dir in, uasset dir out, timeout)
     // The first param is the Commandlet name, so ignore that
@@ -107,7 +147,7 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
         HOUDINI_LOG_MESSAGE(TEXT("HoudiniEngineTestCommandlet:"));
         HOUDINI_LOG_MESSAGE(TEXT("Converts .bgeo files in directory to Static Meshes .uasset files in a Out directory."));
 
-        HOUDINI_LOG_MESSAGE(TEXT("Usage: -run=HoudiniEngineConvertBgeoDir BGEO_DIR_IN UASSET_DIR_OUT TIMEOUT"));
+        HOUDINI_LOG_MESSAGE(TEXT("Usage: -run=HoudiniEngineConvertBgeoDir BGEO_DIR_IN UASSET_DIR_OUT TIMEOUT -jobs=N"));
 
         HOUDINI_LOG_MESSAGE(TEXT("BGEO_DIR_IN"));
         HOUDINI_LOG_MESSAGE(TEXT("\tPath to a directory containing the .bgeo files to convert."));
@@ -118,16 +158,25 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
         HOUDINI_LOG_MESSAGE(TEXT("TIMEOUT (optional)"));
         HOUDINI_LOG_MESSAGE(TEXT("\tAfter this amount of time of inactivity, the commandlet will exit."));
 
+        HOUDINI_LOG_MESSAGE(TEXT("-jobs=N (optional)"));
+        HOUDINI_LOG_MESSAGE(TEXT("\tNumber of .bgeo files loaded and cooked in one batch, defaults to 1. Batches are cooked"));
+        HOUDINI_LOG_MESSAGE(TEXT("\tone after the other in a single Houdini Engine session, this does not start parallel sessions."));
+
         return 1;
     }
 
-    FString BGEODirPath = ArgumentsArray[ 0 ];
-    FString UASSETDirPath = ArgumentsArray.Num() > 1 ? ArgumentsArray[ 1 ] : BGEODirPath;
-    FString InactivityTimeOutStr = ArgumentsArray.Num() > 3 ? ArgumentsArray[ 2 ] : FString();
+    FString BGEODirPath = FPaths::ConvertRelativePathToFull( ArgumentsArray[ 0 ] );
+    FString UASSETDirPath = ArgumentsArray.Num() > 1 ? FPaths::ConvertRelativePathToFull( ArgumentsArray[ 1 ] ) : BGEODirPath;
+    FString InactivityTimeOutStr = ArgumentsArray.Num() > 2 ? ArgumentsArray[ 2 ] : FString();
     float InactivityTimeOut = 1000.0f;
     if ( InactivityTimeOutStr.IsNumeric() )
         InactivityTimeOut = FCString::Atof( *InactivityTimeOutStr );
 
+    // Files are batched in the single Houdini Engine session, not cooked by parallel sessions.
+    int32 NumJobs = 1;
+    FParse::Value( *Params, TEXT( "-jobs=" ), NumJobs );
+    NumJobs = FMath::Max( NumJobs, 1 );
+
     // First check the source directory is valid
     if ( !FPaths::DirectoryExists( BGEODirPath ) )
     {
@@ -144,10 +193,10 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
         return false;
     }
 
-    HOUDINI_LOG_MESSAGE( TEXT( "Looking for .bgeo files in %s ." ), *BGEODirPath );
+    HOUDINI_LOG_MESSAGE( TEXT( "Watching for .bgeo files in %s, converting up to %d per batch." ), *BGEODirPath, NumJobs );
 
-    // Sleep time in seconds before listing the files again
-    const float SleepTime = 1.0f;
+    // Time in seconds spent waiting for directory notifications between two passes
+    const float SleepTime = 0.1f;
     // Maximum number of conversion for a file
     const int32 NumConvertAttempts = 2;
     // If true, will literally try to erase all files before overwriting them
@@ -166,34 +215,133 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
     // Map tracking the number of failures for a given file
     TMap< FString, int32 > FailingFileMap;
 
-    // M<ap listing the files that couldn't/weren't removed
-    TArray< FString > UndeletedFileMap;
+    // Content hash of the bgeo each uasset was converted from, kept next to the uassets between runs
+    const FString HashManifestPath = UASSETDirPath + TEXT( "/" ) + TEXT( "HoudiniBgeoHashes.txt" );
+    TMap< FString, FString > ConvertedHashes;
+    {
+        TArray< FString > ManifestLines;
+        FFileHelper::LoadFileToStringArray( ManifestLines, *HashManifestPath );
+        for ( const FString& Line : ManifestLines )
+        {
+            FString UASSETName, Hash;
+            if ( Line.Split( TEXT( "=" ), &UASSETName, &Hash ) )
+                ConvertedHashes.Add( UASSETName, Hash );
+        }
+    }
+
+    auto IsBGEOFile = []( const FString& FileName )
+    {
+        return FPaths::GetExtension( FileName ).Equals( TEXT( "bgeo" ), ESearchCase::IgnoreCase );
+    };
+
+    // List the directory once, then rely on change notifications
+    FHoudiniBgeoConversionQueue Queue;
+    {
+        TArray< FString > CurrentFileList;
+        FFileManagerGeneric::Get().FindFiles( CurrentFileList, *BGEODirPath, TEXT( ".bgeo" ) );
+        for ( const FString& CurrentFile : CurrentFileList )
+            Queue.Enqueue( CurrentFile );
+    }
+
+    FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked< FDirectoryWatcherModule >( TEXT( "DirectoryWatcher" ) );
+    IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get();
+    FDelegateHandle DirectoryChangedHandle;
+    if ( !DirectoryWatcher || !DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+        BGEODirPath,
+        IDirectoryWatcher::FDirectoryChanged::CreateLambda( [&]( const TArray< FFileChangeData >& FileChanges )
+        {
+            for ( const FFileChangeData& FileChange : FileChanges )
+            {
+                const FString FileName = FPaths::GetCleanFilename( FileChange.Filename );
+                if ( !IsBGEOFile( FileName ) )
+                    continue;
+
+                if ( FileChange.Action == FFileChangeData::FCA_Removed )
+                    Queue.PendingFiles.Remove( FileName );
+                else
+                    Queue.Enqueue( FileName );
+            }
+        } ),
+        DirectoryChangedHandle ) )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not watch the source BGEO directory: %s" ), *BGEODirPath );
+        return 1;
+    }
+
+    // Statistics, reported after each batch and on exit
+    const double StartTime = FPlatformTime::Seconds();
+    int32 ConvertedCount = 0;
+    int32 SkippedCount = 0;
+    int32 FailedCount = 0;
+    int64 ConvertedBytes = 0;
+
+    auto ReportThroughput = [&]()
+    {
+        const double ElapsedTime = FMath::Max( FPlatformTime::Seconds() - StartTime, 0.001 );
+        HOUDINI_LOG_MESSAGE( TEXT( "Converted %d files (%.1f MB), skipped %d unchanged, %d failed in %.1f s: %.2f files/s, %.2f MB/s." ),
+            ConvertedCount, ConvertedBytes / ( 1024.0 * 1024.0 ), SkippedCount, FailedCount, ElapsedTime,
+            ConvertedCount / ElapsedTime, ConvertedBytes / ( 1024.0 * 1024.0 ) / ElapsedTime );
+    };
 
     bool KeepLookingForFile = true;
     float currentInactivity = 0.0f;    
     while ( KeepLookingForFile )
     {
-        // List all the .bgeo files in the directory
-        TArray< FString > CurrentFileList;
-        FFileManagerGeneric::Get().FindFiles( CurrentFileList, *BGEODirPath, TEXT( ".bgeo" ) );
+        // Dispatches the directory change notifications
+        DirectoryWatcher->Tick( SleepTime );
+
+        TArray< FString > BatchFiles;
+        Queue.DequeueSettledFiles( NumJobs, BatchFiles );
 
-        // Convert the files we found
-        int32 ConversionCount = 0;
-        for ( int32 n = CurrentFileList.Num() - 1; n >= 0; n-- )
+        // Update the inactivity counter
+        if ( BatchFiles.Num() == 0 )
         {
-            FString CurrentFile = CurrentFileList[ n ];
+            if ( Queue.PendingFiles.Num() == 0 )
+            {
+                currentInactivity += SleepTime;
+                if ( (InactivityTimeOut > 0.0f ) && ( currentInactivity > InactivityTimeOut ) )
+                    KeepLookingForFile = false;
+            }
 
-            // Skip undeleted files
-            if ( UndeletedFileMap.Contains( CurrentFile ) )
-                continue;
+            // Go to bed for a while...
+            FPlatformProcess::Sleep( SleepTime );
+            continue;
+        }
+
+        // reset the inactivity counter
+        currentInactivity = 0.0f;
+
+        // Hash the batch's files in parallel, unchanged files are skipped
+        TArray< FString > BatchHashes;
+        BatchHashes.SetNum( BatchFiles.Num() );
+        ParallelFor( BatchFiles.Num(), [&]( int32 Idx )
+        {
+            BatchHashes[ Idx ] = LexToString( FMD5Hash::HashFile( *( BGEODirPath + TEXT( "/" ) + BatchFiles[ Idx ] ) ) );
+        } );
+
+        TArray< FString > BGEOFiles;
+        TArray< FString > UASSETFiles;
+        TArray< int32 > FileIndices;
+        for ( int32 n = 0; n < BatchFiles.Num(); n++ )
+        {
+            const FString& CurrentFile = BatchFiles[ n ];
 
             // Skip failing files
-            if ( FailingFileMap.Contains(CurrentFile) && FailingFileMap[ CurrentFile ] >= NumConvertAttempts )
+            if ( FailingFileMap.Contains( CurrentFile ) && FailingFileMap[ CurrentFile ] >= NumConvertAttempts )
                 continue;
 
             // Build the in / out file names
-            FString BGEOFile = BGEODirPath + TEXT("/") + CurrentFileList[ n ];
-            FString UASSETFile = UASSETDirPath + TEXT("/") + CurrentFileList[ n ].LeftChop(5) + TEXT(".uasset");
+            FString BGEOFile = BGEODirPath + TEXT( "/" ) + CurrentFile;
+            FString UASSETName = CurrentFile.LeftChop( 5 ) + TEXT( ".uasset" );
+            FString UASSETFile = UASSETDirPath + TEXT( "/" ) + UASSETName;
+
+            const FString* ConvertedHash = ConvertedHashes.Find( UASSETName );
+            if ( ConvertedHash && *ConvertedHash == BatchHashes[ n ] && FPaths::FileExists( UASSETFile ) )
+            {
+                HOUDINI_LOG_MESSAGE( TEXT( "Skipping unchanged BGEO file: %s" ), *BGEOFile );
+                SkippedCount++;
+                continue;
+            }
 
             if ( CrushFiles )
             {
@@ -204,53 +352,300 @@ int32 UHoudiniEngineConvertBgeoDirCommandlet::Main(const FString& Params)
                 }
             }
 
-            // Attempting to convert the file
-            ConversionCount++;
-            if ( !FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( BGEOFile, UASSETFile ) )
+            BGEOFiles.Add( BGEOFile );
+            UASSETFiles.Add( UASSETFile );
+            FileIndices.Add( n );
+        }
+
+        // Load all the files of the batch, and wait for their cooks at once.
+        // If any of them fails, the files are converted one by one to isolate the failure.
+        double BatchStartTime = FPlatformTime::Seconds();
+        TArray< HAPI_NodeId > NodeIds;
+        NodeIds.Init( -1, BGEOFiles.Num() );
+        bool bBatchCooked = BGEOFiles.Num() > 1;
+        for ( int32 n = 0; n < BGEOFiles.Num() && bBatchCooked; n++ )
+            bBatchCooked = FHoudiniCommandletUtils::CreateBGEOFileNodeInHAPI( BGEOFiles[ n ], NodeIds[ n ] );
+
+        if ( bBatchCooked )
+            bBatchCooked = FHoudiniCommandletUtils::WaitForCookInHAPI();
+
+        if ( bBatchCooked )
+        {
+            HOUDINI_LOG_MESSAGE( TEXT( "Cooked %d BGEO files in %.2f s." ), BGEOFiles.Num(), FPlatformTime::Seconds() - BatchStartTime );
+        }
+        else
+        {
+            for ( HAPI_NodeId& NodeId : NodeIds )
+            {
+                FHoudiniCommandletUtils::ReleaseBGEOFileNodeInHAPI( NodeId );
+                NodeId = -1;
+            }
+        }
+
+        // Converting the files
+        for ( int32 n = 0; n < BGEOFiles.Num(); n++ )
+        {
+            const FString& CurrentFile = BatchFiles[ FileIndices[ n ] ];
+            const double FileStartTime = FPlatformTime::Seconds();
+            if ( !FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( BGEOFiles[ n ], UASSETFiles[ n ], NodeIds[ n ] ) )
             {
-                if ( FailingFileMap.Contains( CurrentFile ) )
-                    FailingFileMap[ CurrentFile ]++;
+                if ( FHoudiniEngineUtils::IsHoudiniNodeValid( NodeIds[ n ] ) )
+                    FHoudiniCommandletUtils::ReleaseBGEOFileNodeInHAPI( NodeIds[ n ] );
+
+                int32& FailureCount = FailingFileMap.FindOrAdd( CurrentFile );
+                FailureCount++;
+                if ( FailureCount < NumConvertAttempts )
+                    Queue.Enqueue( CurrentFile );
                 else
-                    FailingFileMap.Add( CurrentFile, 1 );
+                    FailedCount++;
 
                 continue;
             }
 
-            HOUDINI_LOG_MESSAGE(TEXT("Successfully converted BGEO file: %s to %s"), *BGEOFile, *UASSETFile );
+            const int64 FileSize = FFileManagerGeneric::Get().FileSize( *BGEOFiles[ n ] );
+            ConvertedBytes += FMath::Max< int64 >( FileSize, 0 );
+            ConvertedCount++;
+            ConvertedHashes.Add( FPaths::GetCleanFilename( UASSETFiles[ n ] ), BatchHashes[ FileIndices[ n ] ] );
+
+            HOUDINI_LOG_MESSAGE( TEXT( "Successfully converted BGEO file: %s to %s in %.2f s" ),
+                *BGEOFiles[ n ], *UASSETFiles[ n ], FPlatformTime::Seconds() - FileStartTime );
 
             // Delete the source BGEO
-            if ( !DeleteFileAfterConversion || !FFileManagerGeneric::Get().Delete( *BGEOFile, false, true, true ) )
-                UndeletedFileMap.Add( CurrentFile );
+            if ( DeleteFileAfterConversion )
+                FFileManagerGeneric::Get().Delete( *BGEOFiles[ n ], false, true, true );
         }
 
-        // Update the inactivity counter
-        if ( ConversionCount == 0 )
+        if ( BGEOFiles.Num() > 0 )
         {
-            currentInactivity += SleepTime;
-            if ( (InactivityTimeOut > 0.0f ) && ( currentInactivity > InactivityTimeOut ) )
-                KeepLookingForFile = false;
+            // Save the hashes of the converted files
+            TArray< FString > ManifestLines;
+            for ( const auto& ConvertedHash : ConvertedHashes )
+                ManifestLines.Add( ConvertedHash.Key + TEXT( "=" ) + ConvertedHash.Value );
+            FFileHelper::SaveStringArrayToFile( ManifestLines, *HashManifestPath );
+
+            ReportThroughput();
         }
-        else
+    }
+
+    DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle( BGEODirPath, DirectoryChangedHandle );
+
+    FHoudiniCommandletUtils::ReleaseAllBGEOInputNodesInHAPI();
+
+    if ( CrushFiles )
+    {
+        // Nuke everything in our temporary bake folder
+        FFileManagerGeneric::Get().DeleteDirectory(*LocalAutoBakeFolder, false, true);
+    }
+
+    ReportThroughput();
+#endif
+    return 0;
+}
+
+
+UHoudiniEngineCookBakeCommandlet::UHoudiniEngineCookBakeCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UHoudiniEngineCookBakeCommandlet::Main( const FString& Params )
+{
+#if WITH_EDITOR
+    // Run me via UE4editor.exe my.uproject -run=HoudiniEngineCookBake HDA_IN VARIANTS_CSV UASSET_DIR_OUT (-asset=NAME) (-jobs=N)
+    HOUDINI_LOG_MESSAGE( TEXT( "Houdini Engine Cook and Bake HDA variants" ) );
+
+    // Parse the params to a string arrays, switches are handled separately
+    TArray<FString> ArgumentsArray;
+    Params.ParseIntoArray( ArgumentsArray, TEXT( " " ), true );
+    ArgumentsArray.RemoveAll( []( const FString& Argument ) { return Argument.StartsWith( TEXT( "-" ) ); } );
+
+    if ( ArgumentsArray.Num() != 3 )
+    {
+        // Invalid number of arguments, Print usage and error out
+        HOUDINI_LOG_MESSAGE( TEXT( "HoudiniEngineCookBakeCommandlet:" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "Cooks an HDA once per parameter set and bakes each result to a Static Meshes .uasset file." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "Usage: -run=HoudiniEngineCookBake HDA_IN VARIANTS_CSV UASSET_DIR_OUT -asset=NAME -jobs=N" ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "HDA_IN" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tPath to the .hda/.otl file to cook." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "VARIANTS_CSV" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tComma separated table, one variant per line. The header line names the columns: the first one is the" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tvariant's name, used for its uasset, the others are parameter names, or input:N for the asset's Nth input." ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tTuple values and the object paths of an input are separated by ';'. Empty cells keep the default value." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "UASSET_DIR_OUT" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tPath for the baked uasset files." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "-asset=NAME (optional)" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tName of the asset to cook in the library, defaults to the first one." ) );
+
+        HOUDINI_LOG_MESSAGE( TEXT( "-jobs=N (optional)" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tNumber of variants cooked in one batch, defaults to 1. Batches are cooked one after the" ) );
+        HOUDINI_LOG_MESSAGE( TEXT( "\tother in a single Houdini Engine session, this does not start parallel sessions." ) );
+
+        return 1;
+    }
+
+    const FString HDAFilePath = FPaths::ConvertRelativePathToFull( ArgumentsArray[ 0 ] );
+    const FString VariantsFilePath = FPaths::ConvertRelativePathToFull( ArgumentsArray[ 1 ] );
+    const FString UASSETDirPath = FPaths::ConvertRelativePathToFull( ArgumentsArray[ 2 ] );
+
+    FString AssetName;
+    FParse::Value( *Params, TEXT( "-asset=" ), AssetName );
+
+    // Variants are batched in the single Houdini Engine session, not cooked by parallel sessions.
+    int32 NumJobs = 1;
+    FParse::Value( *Params, TEXT( "-jobs=" ), NumJobs );
+    NumJobs = FMath::Max( NumJobs, 1 );
+
+    if ( !FPaths::DirectoryExists( UASSETDirPath ) )
+    {
+        // Cant find Output dir
+        HOUDINI_LOG_ERROR( TEXT( "The output UASSET directory does not exist: %s" ), *UASSETDirPath );
+        return 1;
+    }
+
+    // Read the variants table
+    TArray< FString > VariantLines;
+    if ( !FFileHelper::LoadFileToStringArray( VariantLines, *VariantsFilePath ) || VariantLines.Num() < 2 )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not read any variant from %s" ), *VariantsFilePath );
+        return 1;
+    }
+
+    TArray< FString > Columns;
+    VariantLines[ 0 ].ParseIntoArray( Columns, TEXT( "," ), false );
+    for ( FString& Column : Columns )
+        Column.TrimStartAndEndInline();
+
+    if ( !FHoudiniCommandletUtils::LoadHDAInHAPI( HDAFilePath, AssetName ) )
+        return 1;
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Cooking %d variants of %s, %d per batch." ), VariantLines.Num() - 1, *AssetName, NumJobs );
+
+    // Nuke everything in our temporary bake folder
+    FFileManagerGeneric::Get().DeleteDirectory( *LocalAutoBakeFolder, false, true );
+
+    // Input nodes, by the objects they were created for, so variants sharing inputs share their nodes
+    TMap< FString, HAPI_NodeId > InputNodeIds;
+    TArray< HAPI_NodeId > CreatedInputNodeIds;
+
+    int32 BakedCount = 0;
+    int32 FailedCount = 0;
+    double CookTime = 0.0;
+    double BakeTime = 0.0;
+    const double StartTime = FPlatformTime::Seconds();
+
+    for ( int32 FirstLine = 1; FirstLine < VariantLines.Num(); FirstLine += NumJobs )
+    {
+        // Instantiate and set up all the variants of the batch, then cook them together
+        const double BatchStartTime = FPlatformTime::Seconds();
+        TArray< FString > VariantNames;
+        TArray< HAPI_NodeId > NodeIds;
+        for ( int32 LineIdx = FirstLine; LineIdx < FMath::Min( FirstLine + NumJobs, VariantLines.Num() ); LineIdx++ )
         {
-            // reset the inactivity counter
-            currentInactivity = 0.0f;
+            TArray< FString > Cells;
+            VariantLines[ LineIdx ].ParseIntoArray( Cells, TEXT( "," ), false );
+            if ( Cells.Num() == 0 || Cells[ 0 ].TrimStartAndEnd().IsEmpty() )
+                continue;
+
+            const FString VariantName = Cells[ 0 ].TrimStartAndEnd();
+            HAPI_NodeId NodeId = -1;
+            bool bSetUp = FHoudiniCommandletUtils::CreateHDANodeInHAPI( AssetName, VariantName, NodeId );
+            for ( int32 ColumnIdx = 1; ColumnIdx < Cells.Num() && ColumnIdx < Columns.Num() && bSetUp; ColumnIdx++ )
+            {
+                const FString Value = Cells[ ColumnIdx ].TrimStartAndEnd();
+                if ( Value.IsEmpty() )
+                    continue;
+
+                if ( !Columns[ ColumnIdx ].StartsWith( TEXT( "input:" ) ) )
+                {
+                    bSetUp = FHoudiniCommandletUtils::SetParameterInHAPI( NodeId, Columns[ ColumnIdx ], Value );
+                    continue;
+                }
+
+                HAPI_NodeId* InputNodeId = InputNodeIds.Find( Value );
+                if ( !InputNodeId )
+                {
+                    HAPI_NodeId NewInputNodeId = -1;
+                    if ( FHoudiniCommandletUtils::CreateInputNodeInHAPI( Value, NewInputNodeId, CreatedInputNodeIds ) )
+                        InputNodeId = &InputNodeIds.Add( Value, NewInputNodeId );
+                }
+
+                bSetUp = InputNodeId && FHoudiniApi::ConnectNodeInput(
+                    FHoudiniEngine::Get().GetSession(), NodeId, FCString::Atoi( *Columns[ ColumnIdx ].RightChop( 6 ) ), *InputNodeId, 0 ) == HAPI_RESULT_SUCCESS;
+            }
+
+            if ( bSetUp )
+                bSetUp = FHoudiniCommandletUtils::CookNodeInHAPI( NodeId );
+
+            if ( !bSetUp )
+            {
+                HOUDINI_LOG_ERROR( TEXT( "Could not set up variant %s: %s" ), *VariantName, *FHoudiniEngineUtils::GetErrorDescription() );
+                if ( NodeId >= 0 )
+                    FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), NodeId );
+                FailedCount++;
+                continue;
+            }
+
+            VariantNames.Add( VariantName );
+            NodeIds.Add( NodeId );
         }
 
-        if ( CrushFiles )
+        // If any cook of the batch fails, the variants are recooked one by one to isolate the failure.
+        const bool bBatchCooked = FHoudiniCommandletUtils::WaitForCookInHAPI();
+        TArray< bool > Cooked;
+        Cooked.Init( bBatchCooked, NodeIds.Num() );
+        for ( int32 n = 0; n < NodeIds.Num() && NodeIds.Num() > 1 && !bBatchCooked; n++ )
+            Cooked[ n ] = FHoudiniCommandletUtils::CookNodeInHAPI( NodeIds[ n ] ) && FHoudiniCommandletUtils::WaitForCookInHAPI();
+
+        const double BatchCookTime = FPlatformTime::Seconds() - BatchStartTime;
+        CookTime += BatchCookTime;
+        HOUDINI_LOG_MESSAGE( TEXT( "Cooked %d variants in %.2f s." ), NodeIds.Num(), BatchCookTime );
+
+        // Bake the cooked variants
+        for ( int32 n = 0; n < NodeIds.Num(); n++ )
         {
-            // Nuke everything in our temporary bake folder
-            FFileManagerGeneric::Get().DeleteDirectory(*LocalAutoBakeFolder, false, true);
-        }
+            const double VariantStartTime = FPlatformTime::Seconds();
+            const FString UASSETFile = UASSETDirPath + TEXT( "/" ) + VariantNames[ n ] + TEXT( ".uasset" );
+            if ( Cooked[ n ] && FHoudiniCommandletUtils::BakeCookedNodeToUAsset( VariantNames[ n ], NodeIds[ n ], UASSETFile ) )
+            {
+                BakedCount++;
+                HOUDINI_LOG_MESSAGE( TEXT( "Baked variant %s to %s in %.2f s." ),
+                    *VariantNames[ n ], *UASSETFile, FPlatformTime::Seconds() - VariantStartTime );
+            }
+            else
+            {
+                FailedCount++;
+                HOUDINI_LOG_ERROR( TEXT( "Could not bake variant %s." ), *VariantNames[ n ] );
+            }
 
-        // Go to bed for a while...
-        FPlatformProcess::Sleep( SleepTime );
+            BakeTime += FPlatformTime::Seconds() - VariantStartTime;
+            FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), NodeIds[ n ] );
+        }
     }
 
-    return 0;
-}
+    for ( HAPI_NodeId InputNodeId : CreatedInputNodeIds )
+        FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), InputNodeId );
+
+    // Nuke everything in our temporary bake folder
+    FFileManagerGeneric::Get().DeleteDirectory( *LocalAutoBakeFolder, false, true );
+
+    HOUDINI_LOG_MESSAGE( TEXT( "Baked %d variants, %d failed, in %.2f s: %.2f s cooking, %.2f s baking." ),
+        BakedCount, FailedCount, FPlatformTime::Seconds() - StartTime, CookTime, BakeTime );
 
+    return FailedCount > 0 ? 1 : 0;
+#else
+    return 1;
+#endif
+}
 
-bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFilePath, const FString& OutUAssetFilePath )
+bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFilePath, const FString& OutUAssetFilePath, HAPI_NodeId LoadedNodeId )
 {
 #if WITH_EDITOR
     //---------------------------------------------------------------------------------------------
@@ -326,15 +721,36 @@ bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFile
     // 3. Load the bgeo file in HAPI
     //---------------------------------------------------------------------------------------------
 
-    HAPI_NodeId NodeId = -1;
-    if ( !FHoudiniCommandletUtils::LoadBGEOFileInHAPI( BGEOFilePath, NodeId) )
+    // The file may already have been loaded and cooked along with others.
+    HAPI_NodeId NodeId = LoadedNodeId;
+    if ( NodeId < 0 && !FHoudiniCommandletUtils::LoadBGEOFileInHAPI( BGEOFilePath, NodeId) )
+        return SaveDebugHipFileAndReturnError();
+
+    //---------------------------------------------------------------------------------------------
+    // 4. Create the Static Meshes from the cooked bgeo and save them to the uasset
+    //---------------------------------------------------------------------------------------------
+
+    if ( !FHoudiniCommandletUtils::BakeCookedNodeToUAsset( BGEOFileName, NodeId, UASSETFilePath ) )
         return SaveDebugHipFileAndReturnError();
 
     //---------------------------------------------------------------------------------------------
-    // 4. Create a package for the result
+    // 5. Release the node in Houdini
     //---------------------------------------------------------------------------------------------
 
-    FString PackagePath = LocalAutoBakeFolder + UASSETFileName;
+    FHoudiniCommandletUtils::ReleaseBGEOFileNodeInHAPI( NodeId );
+#endif
+    return true;
+}
+
+
+bool FHoudiniCommandletUtils::BakeCookedNodeToUAsset( const FString& InputName, HAPI_NodeId NodeId, const FString& UASSETFilePath )
+{
+#if WITH_EDITOR
+    //---------------------------------------------------------------------------------------------
+    // 1. Create a package for the result
+    //---------------------------------------------------------------------------------------------
+
+    FString PackagePath = LocalAutoBakeFolder + FPaths::GetBaseFilename( UASSETFilePath );
     FString PackageFilePath = UPackageTools::SanitizePackageName( PackagePath );
     UPackage * Package = FindPackage( nullptr, *PackageFilePath );
     if ( !Package )    
@@ -359,48 +775,39 @@ bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFile
     auto DeleteLocalPackageAndReturnError = [&]()
     {
         FFileManagerGeneric::Get().Delete( *PackageFilePath, false, true, true );
-        return SaveDebugHipFileAndReturnError();
+        return false;
     };
 
     //---------------------------------------------------------------------------------------------
-    // 5. Create the Static Meshes from  the result of the bgeo cooking
+    // 2. Create the Static Meshes from the result of the cook
     //---------------------------------------------------------------------------------------------
 
     TMap< FHoudiniGeoPartObject, UStaticMesh * > StaticMeshesOut;
     if ( !FHoudiniCommandletUtils::CreateStaticMeshes(
-        BGEOFileName, NodeId, Package, StaticMeshesOut ) )
+        InputName, NodeId, Package, StaticMeshesOut ) )
     {
         // There was some cook errors
-        HOUDINI_LOG_ERROR(TEXT("Could not create Static Meshes from the bgeo!!!"));
-        return SaveDebugHipFileAndReturnError();
+        HOUDINI_LOG_ERROR( TEXT( "Could not create Static Meshes from %s!!!" ), *InputName );
+        return false;
     }
 
     //---------------------------------------------------------------------------------------------
-    // 6. Bake the resulting Static Meshes to the package
-    //---------------------------------------------------------------------------------------------
-
-    if ( !FHoudiniCommandletUtils::BakeStaticMeshesToPackage( BGEOFileName, StaticMeshesOut, Package ) )
-        return SaveDebugHipFileAndReturnError();
-
-    //---------------------------------------------------------------------------------------------
-    // 7. Delete the node in Houdini
+    // 3. Bake the resulting Static Meshes to the package
     //---------------------------------------------------------------------------------------------
 
-    if ( HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), NodeId ) )
-    {
-        // Could not delete the bgeo's file sop !
-        HOUDINI_LOG_WARNING( TEXT( "Could not delete the bgeo file sop for %s"), * BGEOFileName );
-    }
+    if ( !FHoudiniCommandletUtils::BakeStaticMeshesToPackage( InputName, StaticMeshesOut, Package ) )
+        return false;
 
     //---------------------------------------------------------------------------------------------
-    // 8. Save the package
+    // 4. Save the package
     //---------------------------------------------------------------------------------------------
 
     Package->SetDirtyFlag( true );
-    Package->FullyLoad();
 
+    // Same save path as the editor bakes, the package's file is written asynchronously but must be done before the move.
+    TArray< FString > FailedPackageNames;
     FString LocalPackageFileName = FPackageName::LongPackageNameToFilename( PackageFilePath, FPackageName::GetAssetPackageExtension() );
-    if (!UPackage::SavePackage(Package, NULL, RF_Standalone, *LocalPackageFileName, GError, nullptr, false, true, SAVE_NoError))
+    if ( FHoudiniEngineBakeUtils::SaveBakedPackages( { Package }, FailedPackageNames ) != 1 )
     {
         // There was some cook errors
         HOUDINI_LOG_ERROR( TEXT( "Could not save the local package %s"), *PackageFilePath );
@@ -408,7 +815,7 @@ bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFile
     }
 
     //---------------------------------------------------------------------------------------------
-    // 9. Move the local package to its final destination
+    // 5. Move the local package to its final destination
     //---------------------------------------------------------------------------------------------
 
     LocalPackageFileName = FPaths::ConvertRelativePathToFull( LocalPackageFileName );
@@ -421,8 +828,18 @@ bool FHoudiniCommandletUtils::ConvertBGEOFileToUAsset( const FString& InBGEOFile
     return true;
 }
 
-
 bool FHoudiniCommandletUtils::LoadBGEOFileInHAPI( const FString& InputFilePath, HAPI_NodeId& NodeId )
+{
+    if ( !FHoudiniCommandletUtils::CreateBGEOFileNodeInHAPI( InputFilePath, NodeId ) )
+        return false;
+
+    return FHoudiniCommandletUtils::WaitForCookInHAPI();
+}
+
+TSet< HAPI_NodeId > FHoudiniCommandletUtils::BGEOInputNodeIds;
+TArray< HAPI_NodeId > FHoudiniCommandletUtils::FreeBGEOInputNodeIds;
+
+bool FHoudiniCommandletUtils::CreateBGEOFileNodeInHAPI( const FString& InputFilePath, HAPI_NodeId& NodeId )
 {
     NodeId = -1;
 
@@ -433,22 +850,206 @@ bool FHoudiniCommandletUtils::LoadBGEOFileInHAPI( const FString& InputFilePath,
         return false;
     }
 
-    // Create a file SOP
+    // Reuse an input node from a previous file if possible
+    while ( FreeBGEOInputNodeIds.Num() > 0 && NodeId < 0 )
+    {
+        NodeId = FreeBGEOInputNodeIds.Pop( false );
+        if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( NodeId ) )
+        {
+            BGEOInputNodeIds.Remove( NodeId );
+            NodeId = -1;
+        }
+    }
+
+    if ( NodeId < 0 )
+    {
+        if ( FHoudiniApi::CreateInputNode( FHoudiniEngine::Get().GetSession(), &NodeId, "bgeo" ) == HAPI_RESULT_SUCCESS )
+            BGEOInputNodeIds.Add( NodeId );
+        else
+            NodeId = -1;
+    }
+
+    // Load the file's geometry straight in the input node
+    std::string ConvertedString = TCHAR_TO_UTF8( *InputFilePath );
+    if ( NodeId >= 0 && FHoudiniApi::LoadGeoFromFile(
+        FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str() ) != HAPI_RESULT_SUCCESS )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "Could not load %s in an input node, using a file SOP instead." ), *InputFilePath );
+        FHoudiniCommandletUtils::ReleaseBGEOFileNodeInHAPI( NodeId );
+        NodeId = -1;
+    }
+
+    if ( NodeId < 0 )
+    {
+        // Create a file SOP
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+            FHoudiniEngine::Get().GetSession(), -1,
+            "SOP/file", "bgeo", true, &NodeId ), false );
+
+        // Set the file path parameter
+        HAPI_ParmId ParmId = -1;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIdFromName(
+            FHoudiniEngine::Get().GetSession(),
+            NodeId, "file", &ParmId), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmStringValue(
+            FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str(), ParmId, 0 ), false );
+    }
+
+    // Cook the node
+    return FHoudiniCommandletUtils::CookNodeInHAPI( NodeId );
+}
+
+bool FHoudiniCommandletUtils::LoadHDAInHAPI( const FString& HDAFilePath, FString& AssetName )
+{
+    // Check HoudiniEngine / HAPI init?
+    if ( !FHoudiniEngine::IsInitialized() )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Couldn't initialize HoudiniEngine!") );
+        return false;
+    }
+
+    std::string ConvertedString = TCHAR_TO_UTF8( *HDAFilePath );
+    HAPI_AssetLibraryId AssetLibraryId = -1;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::LoadAssetLibraryFromFile(
+        FHoudiniEngine::Get().GetSession(), ConvertedString.c_str(), true, &AssetLibraryId ), false );
+
+    int32 AssetCount = 0;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAvailableAssetCount(
+        FHoudiniEngine::Get().GetSession(), AssetLibraryId, &AssetCount ), false );
+
+    TArray< HAPI_StringHandle > AssetNameHandles;
+    AssetNameHandles.SetNumZeroed( AssetCount );
+    if ( AssetCount > 0 )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAvailableAssets(
+            FHoudiniEngine::Get().GetSession(), AssetLibraryId, &AssetNameHandles[ 0 ], AssetCount ), false );
+    }
+
+    TArray< FString > AssetNames;
+    FHoudiniEngineString::ToFStringBatch( AssetNameHandles, AssetNames );
+
+    // Use the first asset of the library if none was requested
+    if ( AssetName.IsEmpty() && AssetNames.Num() > 0 )
+        AssetName = AssetNames[ 0 ];
+
+    if ( !AssetNames.Contains( AssetName ) )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not find asset %s in %s" ), *AssetName, *HDAFilePath );
+        return false;
+    }
+
+    return true;
+}
+
+bool FHoudiniCommandletUtils::CreateHDANodeInHAPI( const FString& AssetName, const FString& Label, HAPI_NodeId& NodeId )
+{
+    std::string AssetNameString = TCHAR_TO_UTF8( *AssetName );
+    std::string LabelString = TCHAR_TO_UTF8( *Label );
+
+    // Parameters and inputs are set before the first cook
+    NodeId = -1;
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
         FHoudiniEngine::Get().GetSession(), -1,
-        "SOP/file", "bgeo", true, &NodeId ), false );
+        AssetNameString.c_str(), LabelString.c_str(), false, &NodeId ), false );
 
-    // Set the file path parameter
+    return true;
+}
+
+bool FHoudiniCommandletUtils::SetParameterInHAPI( HAPI_NodeId NodeId, const FString& ParmName, const FString& Value )
+{
+    std::string ParmNameString = TCHAR_TO_UTF8( *ParmName );
     HAPI_ParmId ParmId = -1;
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIdFromName(
-        FHoudiniEngine::Get().GetSession(),
-        NodeId, "file", &ParmId), false );
+        FHoudiniEngine::Get().GetSession(), NodeId, ParmNameString.c_str(), &ParmId ), false );
 
-    std::string ConvertedString = TCHAR_TO_UTF8( *InputFilePath );
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmStringValue(
-        FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str(), ParmId, 0 ), false );
+    if ( ParmId < 0 )
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Could not find parameter %s" ), *ParmName );
+        return false;
+    }
+
+    HAPI_ParmInfo ParmInfo;
+    FHoudiniApi::ParmInfo_Init( &ParmInfo );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmInfo(
+        FHoudiniEngine::Get().GetSession(), NodeId, ParmId, &ParmInfo ), false );
+
+    // Tuple values are separated by ';'
+    TArray< FString > Values;
+    Value.ParseIntoArray( Values, TEXT( ";" ), false );
+    const int32 Count = FMath::Min( Values.Num(), (int32) ParmInfo.size );
+
+    if ( FHoudiniApi::ParmInfo_IsInt( &ParmInfo ) )
+    {
+        TArray< int32 > IntValues;
+        for ( int32 Idx = 0; Idx < Count; Idx++ )
+            IntValues.Add( FCString::Atoi( *Values[ Idx ] ) );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmIntValues(
+            FHoudiniEngine::Get().GetSession(), NodeId, IntValues.GetData(), ParmInfo.intValuesIndex, Count ), false );
+    }
+    else if ( FHoudiniApi::ParmInfo_IsFloat( &ParmInfo ) )
+    {
+        TArray< float > FloatValues;
+        for ( int32 Idx = 0; Idx < Count; Idx++ )
+            FloatValues.Add( FCString::Atof( *Values[ Idx ] ) );
 
-    // Cook the node    
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmFloatValues(
+            FHoudiniEngine::Get().GetSession(), NodeId, FloatValues.GetData(), ParmInfo.floatValuesIndex, Count ), false );
+    }
+    else if ( FHoudiniApi::ParmInfo_IsString( &ParmInfo ) )
+    {
+        for ( int32 Idx = 0; Idx < Count; Idx++ )
+        {
+            std::string ConvertedString = TCHAR_TO_UTF8( *Values[ Idx ] );
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmStringValue(
+                FHoudiniEngine::Get().GetSession(), NodeId, ConvertedString.c_str(), ParmId, Idx ), false );
+        }
+    }
+    else
+    {
+        HOUDINI_LOG_ERROR( TEXT( "Parameter %s can not be set from a value" ), *ParmName );
+        return false;
+    }
+
+    return true;
+}
+
+bool FHoudiniCommandletUtils::CreateInputNodeInHAPI(
+    const FString& ObjectPaths, HAPI_NodeId& NodeId, TArray< HAPI_NodeId >& CreatedNodeIds )
+{
+    // Object paths are separated by ';'
+    TArray< FString > Paths;
+    ObjectPaths.ParseIntoArray( Paths, TEXT( ";" ), true );
+
+    TArray< UObject * > InputObjects;
+    for ( const FString& Path : Paths )
+    {
+        UObject * InputObject = LoadObject< UObject >( nullptr, *Path.TrimStartAndEnd() );
+        if ( !InputObject )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Could not load input object %s" ), *Path );
+            return false;
+        }
+
+        InputObjects.Add( InputObject );
+    }
+
+    TArray< FTransform > InputTransforms;
+    InputTransforms.Init( FTransform::Identity, InputObjects.Num() );
+
+    NodeId = -1;
+    const bool bSuccess = FHoudiniEngineUtils::HapiCreateInputNodeForObjects(
+        -1, InputObjects, InputTransforms, NodeId, CreatedNodeIds, false );
+
+    if ( NodeId >= 0 )
+        CreatedNodeIds.AddUnique( NodeId );
+
+    return bSuccess && NodeId >= 0;
+}
+
+bool FHoudiniCommandletUtils::CookNodeInHAPI( HAPI_NodeId NodeId )
+{
     HAPI_CookOptions CookOptions;
     FHoudiniApi::CookOptions_Init(&CookOptions);
     //FMemory::Memzero< HAPI_CookOptions >( CookOptions );
@@ -466,6 +1067,40 @@ bool FHoudiniCommandletUtils::LoadBGEOFileInHAPI( const FString& InputFilePath,
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
         FHoudiniEngine::Get().GetSession(), NodeId, &CookOptions ), false );
 
+    return true;
+}
+
+void FHoudiniCommandletUtils::ReleaseBGEOFileNodeInHAPI( HAPI_NodeId NodeId )
+{
+    if ( NodeId < 0 )
+        return;
+
+    // Input nodes are kept for the next file, file SOPs are deleted
+    if ( BGEOInputNodeIds.Contains( NodeId ) )
+    {
+        FreeBGEOInputNodeIds.AddUnique( NodeId );
+    }
+    else if ( HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), NodeId ) )
+    {
+        // Could not delete the bgeo's file sop !
+        HOUDINI_LOG_WARNING( TEXT( "Could not delete the bgeo file sop %d" ), NodeId );
+    }
+}
+
+void FHoudiniCommandletUtils::ReleaseAllBGEOInputNodesInHAPI()
+{
+    for ( HAPI_NodeId NodeId : BGEOInputNodeIds )
+    {
+        if ( HAPI_RESULT_SUCCESS != FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), NodeId ) )
+            HOUDINI_LOG_WARNING( TEXT( "Could not delete the bgeo input node %d" ), NodeId );
+    }
+
+    BGEOInputNodeIds.Empty();
+    FreeBGEOInputNodeIds.Empty();
+}
+
+bool FHoudiniCommandletUtils::WaitForCookInHAPI()
+{
     // Wait for the cook to finish
     int status = HAPI_STATE_MAX_READY_STATE + 1;
     while ( status > HAPI_STATE_MAX_READY_STATE )
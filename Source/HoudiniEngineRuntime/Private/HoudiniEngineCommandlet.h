@@ -36,16 +36,53 @@ struct FHoudiniGeoPartObject;
 
 struct FHoudiniCommandletUtils
 {
-    static bool ConvertBGEOFileToUAsset( const FString& InBGEOFilePath, const FString& OutUAssetFilePath );
+    /** Converts a bgeo file, LoadedNodeId can be the file node of a bgeo already loaded with CreateBGEOFileNodeInHAPI. **/
+    static bool ConvertBGEOFileToUAsset( const FString& InBGEOFilePath, const FString& OutUAssetFilePath, HAPI_NodeId LoadedNodeId = -1 );
 
     static bool LoadBGEOFileInHAPI( const FString& InputFilePath, HAPI_NodeId& NodeId );
 
+    /** Loads a bgeo in a reusable input node and starts cooking it, without waiting for the cook to finish. **/
+    static bool CreateBGEOFileNodeInHAPI( const FString& InputFilePath, HAPI_NodeId& NodeId );
+
+    /** Returns a node created by CreateBGEOFileNodeInHAPI so the next bgeo can be loaded in it. **/
+    static void ReleaseBGEOFileNodeInHAPI( HAPI_NodeId NodeId );
+
+    /** Deletes all the input nodes kept for bgeo files, used or not. **/
+    static void ReleaseAllBGEOInputNodesInHAPI();
+
+    /** Waits until all pending cooks are done, returns false if any of them had errors. **/
+    static bool WaitForCookInHAPI();
+
     static bool CreateStaticMeshes(
 	const FString& InputName, HAPI_NodeId& NodeId, UPackage* OuterPackage,
 	TMap<FHoudiniGeoPartObject, UStaticMesh *>& StaticMeshesOut );
 
+    /** Creates the Static Meshes of a cooked node and saves them to a uasset file. **/
+    static bool BakeCookedNodeToUAsset( const FString& InputName, HAPI_NodeId NodeId, const FString& UASSETFilePath );
+
+    /** Loads an HDA file, AssetName defaults to the first asset of the library if empty. **/
+    static bool LoadHDAInHAPI( const FString& HDAFilePath, FString& AssetName );
+
+    /** Instantiates an asset of a loaded HDA without cooking it. **/
+    static bool CreateHDANodeInHAPI( const FString& AssetName, const FString& Label, HAPI_NodeId& NodeId );
+
+    /** Sets a parameter from its string value, tuple values are separated by ';'. **/
+    static bool SetParameterInHAPI( HAPI_NodeId NodeId, const FString& ParmName, const FString& Value );
+
+    /** Creates an input node for the objects whose paths are separated by ';'. **/
+    static bool CreateInputNodeInHAPI( const FString& ObjectPaths, HAPI_NodeId& NodeId, TArray< HAPI_NodeId >& CreatedNodeIds );
+
+    /** Starts cooking a node, without waiting for the cook to finish. **/
+    static bool CookNodeInHAPI( HAPI_NodeId NodeId );
+
     static bool BakeStaticMeshesToPackage(
 	const FString& InputName, TMap<FHoudiniGeoPartObject, UStaticMesh *>& StaticMeshes, UPackage* OutPackage );
+
+    private:
+
+        /** Input nodes the bgeo files are loaded in, and the ones currently unused. **/
+        static TSet< HAPI_NodeId > BGEOInputNodeIds;
+        static TArray< HAPI_NodeId > FreeBGEOInputNodeIds;
 };
 
 UCLASS()
@@ -72,6 +109,21 @@ public:
     /** Default constructor. */
     UHoudiniEngineConvertBgeoDirCommandlet();
 
+public:
+
+    //~ UCommandlet interface
+    virtual int32 Main(const FString& Params) override;
+};
+
+UCLASS()
+class UHoudiniEngineCookBakeCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+public:
+
+    /** Default constructor. */
+    UHoudiniEngineCookBakeCommandlet();
+
 public:
 
     //~ UCommandlet interface
@@ -35,6 +35,12 @@
 #include "Materials/MaterialInstanceConstant.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "UObject/MetaData.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#if PLATFORM_CPU_X86_FAMILY
+    #include <emmintrin.h>
+#endif
 #if WITH_EDITOR
     #include "Materials/Material.h"
     #include "Materials/MaterialInstance.h"
@@ -92,6 +98,19 @@ FHoudiniEngineMaterialUtils::HapiCreateMaterials(
     UMaterialFactoryNew * MaterialFactory = NewObject< UMaterialFactoryNew >();
     MaterialFactory->AddToRoot();
 
+    // Materials whose expressions have been regenerated, they are finalized once all textures are ready.
+    TArray< UMaterial * > UpdatedMaterials;
+    TArray< UMaterial * > CreatedMaterials;
+
+    // Temporary cook textures can be created as previews, their full build being deferred.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    const bool bPreviewTextures = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bDeferTemporaryTextureCompression
+        && HoudiniCookParams.MaterialAndTextureBakeMode == EBakeMode::CookToTemp;
+
+    // Texture extraction from HAPI happens on this thread, while the pixel conversion of the extracted
+    // images is done by workers. Textures are finalized when this context goes out of scope or is flushed.
+    FHoudiniTextureCreationContext TextureCreationContext( bPreviewTextures );
+
     for ( TSet< HAPI_NodeId >::TConstIterator IterMaterialId( UniqueMaterialIds ); IterMaterialId; ++IterMaterialId )
     {
         HAPI_NodeId MaterialId = *IterMaterialId;
@@ -216,13 +235,9 @@ FHoudiniEngineMaterialUtils::HapiCreateMaterials(
             // Cache material.
             Materials.Add( MaterialShopName, Material );
 
-            // Propagate and trigger material updates.
+            UpdatedMaterials.Add( Material );
             if ( bCreatedNewMaterial )
-                FAssetRegistryModule::AssetCreated( Material );
-
-            Material->PreEditChange( nullptr );
-            Material->PostEditChange();
-            Material->MarkPackageDirty();
+                CreatedMaterials.Add( Material );
         }
         else
         {
@@ -232,6 +247,20 @@ FHoudiniEngineMaterialUtils::HapiCreateMaterials(
 
     MaterialFactory->RemoveFromRoot();
 
+    // Wait for the texture conversions and finalize the textures before the materials using them.
+    TextureCreationContext.Flush();
+
+    // Propagate and trigger material updates.
+    for ( UMaterial * Material : CreatedMaterials )
+        FAssetRegistryModule::AssetCreated( Material );
+
+    for ( UMaterial * Material : UpdatedMaterials )
+    {
+        Material->PreEditChange( nullptr );
+        Material->PostEditChange();
+        Material->MarkPackageDirty();
+    }
+
 #endif
 }
 
@@ -510,10 +539,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentDiffuse(
             ParmDiffuseTextureId, MaterialInfo, ImageBuffer, PlaneType,
             HAPI_IMAGE_DATA_INT8, ImagePacking, false ) )
         {
-            UPackage * TextureDiffusePackage = nullptr;
-            if ( TextureDiffuse && !TextureDiffuse->IsPendingKill() )
-                TextureDiffusePackage = Cast< UPackage >( TextureDiffuse->GetOuter() );
-
             HAPI_ImageInfo ImageInfo;
             FHoudiniApi::ImageInfo_Init(&ImageInfo);
             Result = FHoudiniApi::GetImageInfo(
@@ -522,34 +547,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentDiffuse(
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
-                // Create texture.
-                FString TextureDiffuseName;
-                bool bCreatedNewTextureDiffuse = false;
-
-                // Create diffuse texture package, if this is a new diffuse texture.
-                if ( !TextureDiffusePackage )
-                {
-                    TextureDiffusePackage = FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
-                        HoudiniCookParams,
-                        MaterialInfo,
-                        HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-                        TextureDiffuseName );
-                }
-
-                // Create diffuse texture, if we need to create one.
-                if ( !TextureDiffuse || TextureDiffuse->IsPendingKill() )
-                    bCreatedNewTextureDiffuse = true;
-
                 // Get the node path to add it to the meta data
                 FString NodePath;
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing diffuse texture, or create new one.
-                TextureDiffuse = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
-                    TextureDiffuse, ImageInfo,
-                    TextureDiffusePackage, TextureDiffuseName, ImageBuffer,
-                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-                    CreateTexture2DParameters, TEXTUREGROUP_World, NodePath );
+                bool bCreatedNewTextureDiffuse = false;
+                TextureDiffuse = FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+                    HoudiniCookParams, MaterialInfo, NodePath, TextureDiffuse, ImageInfo, ImageBuffer,
+                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE, CreateTexture2DParameters,
+                    TEXTUREGROUP_World, bCreatedNewTextureDiffuse );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureDiffuse->SetFlags( RF_Public | RF_Standalone );
@@ -570,12 +577,10 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentDiffuse(
                 // Add expression.
                 Material->Expressions.Add( ExpressionTextureSample );
 
-                // Propagate and trigger diffuse texture updates.
+                // Propagate texture updates, CreateUnrealTexture already triggered its PostEditChange.
                 if ( bCreatedNewTextureDiffuse )
                     FAssetRegistryModule::AssetCreated( TextureDiffuse );
 
-                TextureDiffuse->PreEditChange( nullptr );
-                TextureDiffuse->PostEditChange();
                 TextureDiffuse->MarkPackageDirty();
             }
         }
@@ -768,10 +773,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacityMask(
             if ( ExpressionTextureOpacitySample )
                 TextureOpacity = Cast< UTexture2D >( ExpressionTextureOpacitySample->Texture );
 
-            UPackage * TextureOpacityPackage = nullptr;
-            if ( TextureOpacity )
-                TextureOpacityPackage = Cast< UPackage >( TextureOpacity->GetOuter() );
-
             HAPI_ImageInfo ImageInfo;
             Result = FHoudiniApi::GetImageInfo(
                 FHoudiniEngine::Get().GetSession(),
@@ -779,35 +780,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacityMask(
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
-                // Create texture.
-                FString TextureOpacityName;
-                bool bCreatedNewTextureOpacity = false;
-
-                // Create opacity texture package, if this is a new opacity texture.
-                if ( !TextureOpacityPackage )
-                {
-                    TextureOpacityPackage = FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
-                        HoudiniCookParams,
-                        MaterialInfo,
-                        HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
-                        TextureOpacityName );
-                }
-
-                // Create opacity texture, if we need to create one.
-                if ( !TextureOpacity )
-                    bCreatedNewTextureOpacity = true;
-
                 // Get the node path to add it to the meta data
                 FString NodePath;
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing opacity texture, or create new one.
-                TextureOpacity = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
-                    TextureOpacity, ImageInfo,
-                    TextureOpacityPackage, TextureOpacityName, ImageBuffer,
-                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
-                    CreateTexture2DParameters,
-                    TEXTUREGROUP_World, NodePath );
+                bool bCreatedNewTextureOpacity = false;
+                TextureOpacity = FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+                    HoudiniCookParams, MaterialInfo, NodePath, TextureOpacity, ImageInfo, ImageBuffer,
+                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK, CreateTexture2DParameters,
+                    TEXTUREGROUP_World, bCreatedNewTextureOpacity );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureOpacity->SetFlags(RF_Public | RF_Standalone);
@@ -847,12 +829,10 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacityMask(
                 Material->OpacityMask.MaskB = 0;
                 Material->OpacityMask.MaskA = 0;
 
-                // Propagate and trigger opacity texture updates.
+                // Propagate texture updates, CreateUnrealTexture already triggered its PostEditChange.
                 if ( bCreatedNewTextureOpacity )
                     FAssetRegistryModule::AssetCreated( TextureOpacity );
 
-                TextureOpacity->PreEditChange( nullptr );
-                TextureOpacity->PostEditChange();
                 TextureOpacity->MarkPackageDirty();
 
                 bExpressionCreated = true;
@@ -916,6 +896,12 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentOpacity(
             if ( ExpressionTextureDiffuseSample )
             {
                 UTexture2D * DiffuseTexture = Cast< UTexture2D >( ExpressionTextureDiffuseSample->Texture );
+
+                // The alpha detection of a pending diffuse texture must be complete before we can look at it.
+                FHoudiniTextureCreationContext * TextureCreationContext = FHoudiniTextureCreationContext::Get();
+                if ( DiffuseTexture && TextureCreationContext )
+                    TextureCreationContext->FlushTexture( DiffuseTexture );
+
                 if ( DiffuseTexture && !DiffuseTexture->CompressionNoAlpha )
                 {
                     // The diffuse texture has an alpha channel (that wasn't discarded), so we can use it
@@ -1152,10 +1138,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                 }
             }
 
-            UPackage * TextureNormalPackage = nullptr;
-            if ( TextureNormal )
-                TextureNormalPackage = Cast< UPackage >( TextureNormal->GetOuter() );
-
             HAPI_ImageInfo ImageInfo;
             FHoudiniApi::ImageInfo_Init(&ImageInfo);
             Result = FHoudiniApi::GetImageInfo(
@@ -1164,37 +1146,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
-                // Create texture.
-                FString TextureNormalName;
-                bool bCreatedNewTextureNormal = false;
-
-                // Create normal texture package, if this is a new normal texture.
-                if ( !TextureNormalPackage )
-                {
-                    TextureNormalPackage =
-                        FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
-                            HoudiniCookParams,
-                            MaterialInfo,
-                            HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-                            TextureNormalName );
-                }
-
-                // Create normal texture, if we need to create one.
-                if ( !TextureNormal )
-                    bCreatedNewTextureNormal = true;
-
                 // Get the node path to add it to the meta data
                 FString NodePath;
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing normal texture, or create new one.
-                TextureNormal = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
-                    TextureNormal, ImageInfo,
-                    TextureNormalPackage, TextureNormalName, ImageBuffer,
-                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-                    CreateTexture2DParameters,
-                    TEXTUREGROUP_WorldNormalMap,
-                    NodePath );
+                bool bCreatedNewTextureNormal = false;
+                TextureNormal = FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+                    HoudiniCookParams, MaterialInfo, NodePath, TextureNormal, ImageInfo, ImageBuffer,
+                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, CreateTexture2DParameters,
+                    TEXTUREGROUP_WorldNormalMap, bCreatedNewTextureNormal );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -1285,10 +1246,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                     }
                 }
 
-                UPackage * TextureNormalPackage = nullptr;
-                if ( TextureNormal )
-                    TextureNormalPackage = Cast< UPackage >( TextureNormal->GetOuter() );
-
                 HAPI_ImageInfo ImageInfo;
                 FHoudiniApi::ImageInfo_Init(&ImageInfo);
                 Result = FHoudiniApi::GetImageInfo(
@@ -1297,34 +1254,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
 
                 if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
                 {
-                    // Create texture.
-                    FString TextureNormalName;
-                    bool bCreatedNewTextureNormal = false;
-
-                    // Create normal texture package, if this is a new normal texture.
-                    if ( !TextureNormalPackage )
-                    {
-                        TextureNormalPackage = FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
-                            HoudiniCookParams,
-                            MaterialInfo,
-                            HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-                            TextureNormalName );
-                    }
-
-                    // Create normal texture, if we need to create one.
-                    if ( !TextureNormal )
-                        bCreatedNewTextureNormal = true;
-
                     // Get the node path to add it to the meta data
                     FString NodePath;
                     GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                     // Reuse existing normal texture, or create new one.
-                    TextureNormal = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
-                        TextureNormal, ImageInfo,
-                        TextureNormalPackage, TextureNormalName, ImageBuffer,
+                    bool bCreatedNewTextureNormal = false;
+                    TextureNormal = FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+                        HoudiniCookParams, MaterialInfo, NodePath, TextureNormal, ImageInfo, ImageBuffer,
                         HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, CreateTexture2DParameters,
-                        TEXTUREGROUP_WorldNormalMap, NodePath );
+                        TEXTUREGROUP_WorldNormalMap, bCreatedNewTextureNormal );
 
                     if ( BakeMode == EBakeMode::CookToTemp )
                         TextureNormal->SetFlags( RF_Public | RF_Standalone );
@@ -1353,12 +1292,10 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentNormal(
                     Material->Expressions.Add( ExpressionNormal );
                     Material->Normal.Expression = ExpressionNormal;
 
-                    // Propagate and trigger diffuse texture updates.
+                    // Propagate texture updates, CreateUnrealTexture already triggered its PostEditChange.
                     if ( bCreatedNewTextureNormal )
                         FAssetRegistryModule::AssetCreated( TextureNormal );
 
-                    TextureNormal->PreEditChange( nullptr );
-                    TextureNormal->PostEditChange();
                     TextureNormal->MarkPackageDirty();
 
                     bExpressionCreated = true;
@@ -1440,10 +1377,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentSpecular(
                 }
             }
 
-            UPackage * TextureSpecularPackage = nullptr;
-            if ( TextureSpecular )
-                TextureSpecularPackage = Cast< UPackage >( TextureSpecular->GetOuter() );
-
             HAPI_ImageInfo ImageInfo;
             FHoudiniApi::ImageInfo_Init(&ImageInfo);
             Result = FHoudiniApi::GetImageInfo(
@@ -1452,35 +1385,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentSpecular(
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
-                // Create texture.
-                FString TextureSpecularName;
-                bool bCreatedNewTextureSpecular = false;
-
-                // Create specular texture package, if this is a new specular texture.
-                if ( !TextureSpecularPackage )
-                {
-                    TextureSpecularPackage = FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
-                        HoudiniCookParams,
-                        MaterialInfo,
-                        HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
-                        TextureSpecularName );
-                }
-
-                // Create specular texture, if we need to create one.
-                if ( !TextureSpecular )
-                    bCreatedNewTextureSpecular = true;
-
                 // Get the node path to add it to the meta data
                 FString NodePath;
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing specular texture, or create new one.
-                TextureSpecular = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
-                    TextureSpecular, ImageInfo,
-                    TextureSpecularPackage, TextureSpecularName, ImageBuffer,
-                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
-                    CreateTexture2DParameters,
-                    TEXTUREGROUP_World, NodePath );
+                bool bCreatedNewTextureSpecular = false;
+                TextureSpecular = FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+                    HoudiniCookParams, MaterialInfo, NodePath, TextureSpecular, ImageInfo, ImageBuffer,
+                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR, CreateTexture2DParameters,
+                    TEXTUREGROUP_World, bCreatedNewTextureSpecular );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureSpecular->SetFlags( RF_Public | RF_Standalone );
@@ -1661,10 +1575,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentRoughness(
                 }
             }
 
-            UPackage * TextureRoughnessPackage = nullptr;
-            if ( TextureRoughness )
-                TextureRoughnessPackage = Cast< UPackage >( TextureRoughness->GetOuter() );
-
             HAPI_ImageInfo ImageInfo;
             FHoudiniApi::ImageInfo_Init(&ImageInfo);
             Result = FHoudiniApi::GetImageInfo(
@@ -1673,35 +1583,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentRoughness(
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
-                // Create texture.
-                FString TextureRoughnessName;
-                bool bCreatedNewTextureRoughness = false;
-
-                // Create roughness texture package, if this is a new roughness texture.
-                if ( !TextureRoughnessPackage )
-                {
-                    TextureRoughnessPackage = FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
-                        HoudiniCookParams,
-                        MaterialInfo,
-                        HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
-                        TextureRoughnessName );
-                }
-
-                // Create roughness texture, if we need to create one.
-                if ( !TextureRoughness )
-                    bCreatedNewTextureRoughness = true;
-
                 // Get the node path to add it to the meta data
                 FString NodePath;
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing roughness texture, or create new one.
-                TextureRoughness = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
-                    TextureRoughness, ImageInfo,
-                    TextureRoughnessPackage, TextureRoughnessName, ImageBuffer,
-                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
-                    CreateTexture2DParameters,
-                    TEXTUREGROUP_World, NodePath );
+                bool bCreatedNewTextureRoughness = false;
+                TextureRoughness = FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+                    HoudiniCookParams, MaterialInfo, NodePath, TextureRoughness, ImageInfo, ImageBuffer,
+                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS, CreateTexture2DParameters,
+                    TEXTUREGROUP_World, bCreatedNewTextureRoughness );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureRoughness->SetFlags( RF_Public | RF_Standalone );
@@ -1874,10 +1765,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentMetallic(
                 }
             }
 
-            UPackage * TextureMetallicPackage = nullptr;
-            if ( TextureMetallic )
-                TextureMetallicPackage = Cast< UPackage >( TextureMetallic->GetOuter() );
-
             HAPI_ImageInfo ImageInfo;
             FHoudiniApi::ImageInfo_Init(&ImageInfo);
             Result = FHoudiniApi::GetImageInfo(
@@ -1886,35 +1773,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentMetallic(
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
-                // Create texture.
-                FString TextureMetallicName;
-                bool bCreatedNewTextureMetallic = false;
-
-                // Create metallic texture package, if this is a new metallic texture.
-                if ( !TextureMetallicPackage )
-                {
-                    TextureMetallicPackage = FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
-                        HoudiniCookParams,
-                        MaterialInfo,
-                        HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
-                        TextureMetallicName );
-                }
-
-                // Create metallic texture, if we need to create one.
-                if ( !TextureMetallic )
-                    bCreatedNewTextureMetallic = true;
-
                 // Get the node path to add it to the meta data
                 FString NodePath;
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing metallic texture, or create new one.
-                TextureMetallic = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
-                    TextureMetallic, ImageInfo,
-                    TextureMetallicPackage, TextureMetallicName, ImageBuffer,
-                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
-                    CreateTexture2DParameters,
-                    TEXTUREGROUP_World, NodePath );
+                bool bCreatedNewTextureMetallic = false;
+                TextureMetallic = FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+                    HoudiniCookParams, MaterialInfo, NodePath, TextureMetallic, ImageInfo, ImageBuffer,
+                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC, CreateTexture2DParameters,
+                    TEXTUREGROUP_World, bCreatedNewTextureMetallic );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureMetallic->SetFlags( RF_Public | RF_Standalone );
@@ -2078,10 +1946,6 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentEmissive(
                 }
             }
 
-            UPackage * TextureEmissivePackage = nullptr;
-            if ( TextureEmissive )
-                TextureEmissivePackage = Cast< UPackage >( TextureEmissive->GetOuter() );
-
             HAPI_ImageInfo ImageInfo;
             FHoudiniApi::ImageInfo_Init(&ImageInfo);
             Result = FHoudiniApi::GetImageInfo(
@@ -2090,35 +1954,16 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentEmissive(
 
             if ( Result == HAPI_RESULT_SUCCESS && ImageInfo.xRes > 0 && ImageInfo.yRes > 0 )
             {
-                // Create texture.
-                FString TextureEmissiveName;
-                bool bCreatedNewTextureEmissive = false;
-
-                // Create emissive texture package, if this is a new emissive texture.
-                if ( !TextureEmissivePackage )
-                {
-                    TextureEmissivePackage = FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
-                        HoudiniCookParams,
-                        MaterialInfo,
-                        HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
-                        TextureEmissiveName );
-                }
-
-                // Create emissive texture, if we need to create one.
-                if ( !TextureEmissive )
-                    bCreatedNewTextureEmissive = true;
-
                 // Get the node path to add it to the meta data
                 FString NodePath;
                 GetUniqueMaterialShopName( AssetId, MaterialInfo.nodeId, NodePath );
 
                 // Reuse existing emissive texture, or create new one.
-                TextureEmissive = FHoudiniEngineMaterialUtils::CreateUnrealTexture(
-                    TextureEmissive, ImageInfo,
-                    TextureEmissivePackage, TextureEmissiveName, ImageBuffer,
-                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
-                    CreateTexture2DParameters,
-                    TEXTUREGROUP_World, NodePath );
+                bool bCreatedNewTextureEmissive = false;
+                TextureEmissive = FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+                    HoudiniCookParams, MaterialInfo, NodePath, TextureEmissive, ImageInfo, ImageBuffer,
+                    HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE, CreateTexture2DParameters,
+                    TEXTUREGROUP_World, bCreatedNewTextureEmissive );
 
                 if ( BakeMode == EBakeMode::CookToTemp )
                     TextureEmissive->SetFlags( RF_Public | RF_Standalone );
@@ -2226,20 +2071,141 @@ FHoudiniEngineMaterialUtils::CreateMaterialComponentEmissive(
     return bExpressionCreated;
 }
 
+bool
+FHoudiniEngineMaterialUtils::ConvertImageRGBAToBGRA(
+    const uint8 * SrcData, uint8 * DestData, int32 Width, int32 Height, bool bUseAlpha )
+{
+    if ( !SrcData || !DestData || Width <= 0 || Height <= 0 )
+        return false;
+
+    // Each pixel is processed as a little endian 32 bit word: R and B are exchanged, G and A stay in place.
+    // When alpha is not used, it is forced to 0xFF by OR-ing the alpha mask in.
+    const uint32 AlphaMask = 0xFF000000;
+    const uint32 ForcedAlpha = bUseAlpha ? 0u : AlphaMask;
+
+    // Per row flag, set when a pixel of that row has an alpha value different from 0xFF.
+    TArray< uint8 > RowHasAlpha;
+    RowHasAlpha.SetNumZeroed( Height );
+
+    ParallelFor( Height, [&]( int32 y )
+    {
+        const uint32 * SrcRow = (const uint32 *) ( SrcData + (SIZE_T) y * Width * 4 );
+        uint32 * DestRow = (uint32 *) ( DestData + (SIZE_T) ( Height - 1 - y ) * Width * 4 );
+
+        // All alpha bits AND-ed together: the row has alpha if the result is not 0xFF.
+        uint32 AlphaAccumulator = AlphaMask;
+        int32 x = 0;
+
+#if PLATFORM_CPU_X86_FAMILY
+        const __m128i MaskGA = _mm_set1_epi32( 0xFF00FF00 );
+        const __m128i MaskB = _mm_set1_epi32( 0x00FF0000 );
+        const __m128i MaskR = _mm_set1_epi32( 0x000000FF );
+        const __m128i Forced = _mm_set1_epi32( (int32) ForcedAlpha );
+        __m128i AlphaAccumulator4 = _mm_set1_epi32( (int32) AlphaMask );
+
+        for ( ; x + 4 <= Width; x += 4 )
+        {
+            const __m128i Pixels = _mm_loadu_si128( (const __m128i *) ( SrcRow + x ) );
+            __m128i Swizzled = _mm_and_si128( Pixels, MaskGA );
+            Swizzled = _mm_or_si128( Swizzled, _mm_srli_epi32( _mm_and_si128( Pixels, MaskB ), 16 ) );
+            Swizzled = _mm_or_si128( Swizzled, _mm_slli_epi32( _mm_and_si128( Pixels, MaskR ), 16 ) );
+            Swizzled = _mm_or_si128( Swizzled, Forced );
+            _mm_storeu_si128( (__m128i *) ( DestRow + x ), Swizzled );
+
+            AlphaAccumulator4 = _mm_and_si128( AlphaAccumulator4, Pixels );
+        }
+
+        // Reduce the four lanes.
+        alignas( 16 ) uint32 Lanes[ 4 ];
+        _mm_store_si128( (__m128i *) Lanes, AlphaAccumulator4 );
+        AlphaAccumulator &= Lanes[ 0 ] & Lanes[ 1 ] & Lanes[ 2 ] & Lanes[ 3 ];
+#endif
+
+        for ( ; x < Width; ++x )
+        {
+            const uint32 Pixel = SrcRow[ x ];
+            DestRow[ x ] = ( Pixel & 0xFF00FF00 ) | ( ( Pixel & 0x00FF0000 ) >> 16 ) | ( ( Pixel & 0x000000FF ) << 16 ) | ForcedAlpha;
+            AlphaAccumulator &= Pixel;
+        }
+
+        RowHasAlpha[ y ] = ( ( AlphaAccumulator & AlphaMask ) != AlphaMask ) ? 1 : 0;
+    } );
+
+    // Alpha is only relevant if the texture uses it.
+    if ( !bUseAlpha )
+        return false;
+
+    for ( int32 y = 0; y < Height; ++y )
+    {
+        if ( RowHasAlpha[ y ] )
+            return true;
+    }
+
+    return false;
+}
+
+FString
+FHoudiniEngineMaterialUtils::ComputeImageBufferHash(
+    const HAPI_ImageInfo & ImageInfo, const TArray< char > & ImageBuffer,
+    const FCreateTexture2DParameters & TextureParameters )
+{
+    // Resolution and creation parameters are part of the hash as they change the resulting texture.
+    const int32 Header[] =
+    {
+        ImageInfo.xRes, ImageInfo.yRes,
+        TextureParameters.bUseAlpha ? 1 : 0,
+        TextureParameters.bSRGB ? 1 : 0,
+        (int32) TextureParameters.CompressionSettings
+    };
+
+    const uint64 HeaderHash = CityHash64( (const char *) Header, sizeof( Header ) );
+    const uint64 Hash = CityHash64WithSeed( ImageBuffer.GetData(), ImageBuffer.Num(), HeaderHash );
+
+    return FString::Printf( TEXT( "%016llx" ), Hash );
+}
+
 UTexture2D *
 FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     UTexture2D * ExistingTexture, const HAPI_ImageInfo & ImageInfo,
     UPackage * Package, const FString & TextureName,
-    const TArray< char > & ImageBuffer, const FString & TextureType,
-    const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup, const FString& NodePath )
+    TArray< char > & ImageBuffer, const FString & TextureType,
+    const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup, const FString& NodePath,
+    const FString & InTextureHash )
 {
     if (!Package || Package->IsPendingKill())
         return nullptr;
 
+    // Hash the extracted image so unchanged textures are neither re-uploaded nor recompressed.
+    const FString TextureHash = !InTextureHash.IsEmpty() ? InTextureHash :
+        FHoudiniEngineMaterialUtils::ComputeImageBufferHash( ImageInfo, ImageBuffer, TextureParameters );
+
+    FHoudiniTextureCreationContext * TextureCreationContext = FHoudiniTextureCreationContext::Get();
+
     UTexture2D * Texture = nullptr;
     if ( ExistingTexture )
     {
         Texture = ExistingTexture;
+
+        // Make sure a previous conversion of this texture in the current context is complete.
+        if ( TextureCreationContext )
+            TextureCreationContext->FlushTexture( Texture );
+
+        UMetaData * MetaData = Package->GetMetaData();
+        if ( MetaData && !MetaData->IsPendingKill()
+            && Texture->Source.IsValid()
+            && Texture->Source.GetSizeX() == ImageInfo.xRes
+            && Texture->Source.GetSizeY() == ImageInfo.yRes
+            && MetaData->GetValue( Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH ) == TextureHash )
+        {
+            // The texture content is identical to the previous cook, only refresh the node path.
+            FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+                Package, Texture, HAPI_UNREAL_PACKAGE_META_NODE_PATH, *NodePath );
+
+            if ( TextureCreationContext )
+                TextureCreationContext->AddTextureHash( TextureHash, Texture );
+
+            return Texture;
+        }
     }
     else
     {
@@ -2261,6 +2227,8 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
         Package, Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE, *TextureType );
     FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
         Package, Texture, HAPI_UNREAL_PACKAGE_META_NODE_PATH, *NodePath );
+    FHoudiniEngineBakeUtils::AddHoudiniMetaInformationToPackage(
+        Package, Texture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH, *TextureHash );
 
     // Initialize texture source.
     Texture->Source.Init( ImageInfo.xRes, ImageInfo.yRes, 1, 1, TSF_BGRA8 );
@@ -2268,52 +2236,85 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     // Lock the texture.
     uint8 * MipData = Texture->Source.LockMip( 0 );
 
-    // Create base map.
-    uint8* DestPtr = nullptr;
-    uint32 SrcWidth = ImageInfo.xRes;
-    uint32 SrcHeight = ImageInfo.yRes;
-    const char * SrcData = &ImageBuffer[ 0 ];
-
-    for ( uint32 y = 0; y < SrcHeight; y++ )
+    // If a texture creation context is active, the conversion runs on a worker thread
+    // and the texture is finalized when the context is flushed.
+    if ( TextureCreationContext )
     {
-        DestPtr = &MipData[ ( SrcHeight - 1 - y ) * SrcWidth * sizeof( FColor ) ];
+        TextureCreationContext->AddTextureHash( TextureHash, Texture );
+        TextureCreationContext->AddPendingTexture(
+            Texture, MipData, ImageInfo.xRes, ImageInfo.yRes, ImageBuffer, TextureParameters );
 
-        for ( uint32 x = 0; x < SrcWidth; x++ )
-        {
-            uint32 DataOffset = y * SrcWidth * 4 + x * 4;
+        return Texture;
+    }
 
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 2 ); // B
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 1 ); // G
-            *DestPtr++ = *(uint8*)( SrcData + DataOffset + 0 ); // R
+    // Swizzle to BGRA, flip vertically and look for a meaningful alpha value in a single pass.
+    const bool bHasAlphaValue = FHoudiniEngineMaterialUtils::ConvertImageRGBAToBGRA(
+        (const uint8 *) ImageBuffer.GetData(), MipData,
+        ImageInfo.xRes, ImageInfo.yRes, TextureParameters.bUseAlpha );
 
-            if ( TextureParameters.bUseAlpha )
-                *DestPtr++ = *(uint8*)( SrcData + DataOffset + 3 ); // A
-            else
-                *DestPtr++ = 0xFF;
+    FHoudiniEngineMaterialUtils::FinalizeUnrealTexture( Texture, TextureParameters, bHasAlphaValue, false );
+
+    return Texture;
+}
+
+UTexture2D *
+FHoudiniEngineMaterialUtils::ResolveGeneratedTexture(
+    FHoudiniCookParams & HoudiniCookParams, const HAPI_MaterialInfo & MaterialInfo, const FString & NodePath,
+    UTexture2D * ExistingTexture, const HAPI_ImageInfo & ImageInfo, TArray< char > & ImageBuffer,
+    const FString & TextureType, const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup,
+    bool & bOutCreatedNewTexture )
+{
+    bOutCreatedNewTexture = false;
+
+    // The texture used by the previous cook might be another material's texture that was shared with us.
+    // It only belongs to us if its package's meta information records our material and texture type.
+    if ( ExistingTexture )
+    {
+        UMetaData * MetaData = !ExistingTexture->IsPendingKill() ? ExistingTexture->GetOutermost()->GetMetaData() : nullptr;
+        if ( !MetaData || MetaData->IsPendingKill()
+            || MetaData->GetValue( ExistingTexture, HAPI_UNREAL_PACKAGE_META_NODE_PATH ) != NodePath
+            || MetaData->GetValue( ExistingTexture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE ) != TextureType )
+        {
+            ExistingTexture = nullptr;
         }
     }
 
-    bool bHasAlphaValue = false;
-    if ( TextureParameters.bUseAlpha )
+    // Identical planes used by several materials resolve to the texture generated first during this cook.
+    // This is looked up before any package is created, so a shared texture doesn't leave an empty package behind.
+    FString TextureHash;
+    FHoudiniTextureCreationContext * TextureCreationContext = FHoudiniTextureCreationContext::Get();
+    if ( TextureCreationContext )
     {
-        // See if there is an actual alpha value in the texture or if we can ignore the texture alpha
-        for ( uint32 y = 0; y < SrcHeight; y++ )
-        {
-            for ( uint32 x = 0; x < SrcWidth; x++ )
-            {
-                uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-                if (*(uint8*)(SrcData + DataOffset + 3) != 0xFF)
-                {
-                    bHasAlphaValue = true;
-                    break;
-                }
-            }
+        TextureHash = FHoudiniEngineMaterialUtils::ComputeImageBufferHash( ImageInfo, ImageBuffer, TextureParameters );
+        UTexture2D * SharedTexture = TextureCreationContext->FindTextureByHash( TextureHash );
+        if ( SharedTexture && !SharedTexture->IsPendingKill() && SharedTexture != ExistingTexture )
+            return SharedTexture;
+    }
 
-            if ( bHasAlphaValue )
-                break;
-        }
+    // Update our own texture in place, or create a new texture in its own package.
+    FString TextureName;
+    UPackage * TexturePackage = nullptr;
+    if ( ExistingTexture )
+    {
+        TexturePackage = Cast< UPackage >( ExistingTexture->GetOuter() );
+    }
+    else
+    {
+        TexturePackage = FHoudiniEngineBakeUtils::BakeCreateTexturePackageForComponent(
+            HoudiniCookParams, MaterialInfo, TextureType, TextureName );
+        bOutCreatedNewTexture = true;
     }
 
+    return FHoudiniEngineMaterialUtils::CreateUnrealTexture(
+        ExistingTexture, ImageInfo, TexturePackage, TextureName, ImageBuffer,
+        TextureType, TextureParameters, LODGroup, NodePath, TextureHash );
+}
+
+void
+FHoudiniEngineMaterialUtils::FinalizeUnrealTexture(
+    UTexture2D * Texture, const FCreateTexture2DParameters & TextureParameters,
+    bool bHasAlphaValue, bool bPreviewTexture )
+{
     // Unlock the texture.
     Texture->Source.UnlockMip( 0 );
 
@@ -2323,6 +2324,19 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     Texture->CompressionNoAlpha = !bHasAlphaValue;
     Texture->DeferCompression = TextureParameters.bDeferCompression;
 
+    if ( bPreviewTexture )
+    {
+        // Preview textures skip mipmaps and compression, their full build happens when cooking is idle.
+        FHoudiniEngine::Get().AddDeferredTextureBuild( Texture );
+        Texture->MipGenSettings = TMGS_NoMipmaps;
+        Texture->DeferCompression = true;
+    }
+    else
+    {
+        // A pending preview gets its previous mip settings back, otherwise they are left untouched.
+        FHoudiniEngine::Get().RemoveDeferredTextureBuild( Texture );
+    }
+
     // Set the Source Guid/Hash if specified.
     /*
     if ( TextureParameters.SourceGuidHash.IsValid() )
@@ -2332,8 +2346,94 @@ FHoudiniEngineMaterialUtils::CreateUnrealTexture(
     */
 
     Texture->PostEditChange();
+}
 
-    return Texture;
+FHoudiniTextureCreationContext *
+FHoudiniTextureCreationContext::CurrentContext = nullptr;
+
+FHoudiniTextureCreationContext::FHoudiniTextureCreationContext( bool bInPreviewTextures )
+    : PreviousContext( CurrentContext )
+    , bPreviewTextures( bInPreviewTextures )
+{
+    check( IsInGameThread() );
+    CurrentContext = this;
+}
+
+FHoudiniTextureCreationContext::~FHoudiniTextureCreationContext()
+{
+    Flush();
+    CurrentContext = PreviousContext;
+}
+
+FHoudiniTextureCreationContext *
+FHoudiniTextureCreationContext::Get()
+{
+    return IsInGameThread() ? CurrentContext : nullptr;
+}
+
+void
+FHoudiniTextureCreationContext::AddPendingTexture(
+    UTexture2D * Texture, uint8 * MipData, int32 Width, int32 Height,
+    TArray< char > & ImageBuffer, const FCreateTexture2DParameters & TextureParameters )
+{
+    FPendingTexture & PendingTexture = PendingTextures.AddDefaulted_GetRef();
+    PendingTexture.Texture = Texture;
+    PendingTexture.TextureParameters = TextureParameters;
+
+    // The worker takes ownership of the extracted image.
+    const bool bUseAlpha = TextureParameters.bUseAlpha;
+    PendingTexture.HasAlphaValue = Async( EAsyncExecution::ThreadPool,
+        [ Buffer = MoveTemp( ImageBuffer ), MipData, Width, Height, bUseAlpha ]()
+        {
+            return FHoudiniEngineMaterialUtils::ConvertImageRGBAToBGRA(
+                (const uint8 *) Buffer.GetData(), MipData, Width, Height, bUseAlpha );
+        } );
+}
+
+UTexture2D *
+FHoudiniTextureCreationContext::FindTextureByHash( const FString & TextureHash ) const
+{
+    UTexture2D * const * FoundTexture = TexturesByHash.Find( TextureHash );
+    return FoundTexture ? *FoundTexture : nullptr;
+}
+
+void
+FHoudiniTextureCreationContext::AddTextureHash( const FString & TextureHash, UTexture2D * Texture )
+{
+    TexturesByHash.Add( TextureHash, Texture );
+}
+
+void
+FHoudiniTextureCreationContext::FlushTexture( UTexture2D * Texture )
+{
+    for ( int32 Idx = PendingTextures.Num() - 1; Idx >= 0; --Idx )
+    {
+        FPendingTexture & PendingTexture = PendingTextures[ Idx ];
+        if ( PendingTexture.Texture != Texture )
+            continue;
+
+        const bool bHasAlphaValue = PendingTexture.HasAlphaValue.Get();
+        FHoudiniEngineMaterialUtils::FinalizeUnrealTexture(
+            Texture, PendingTexture.TextureParameters, bHasAlphaValue, bPreviewTextures );
+
+        PendingTextures.RemoveAt( Idx );
+        break;
+    }
+}
+
+void
+FHoudiniTextureCreationContext::Flush()
+{
+    for ( FPendingTexture & PendingTexture : PendingTextures )
+    {
+        const bool bHasAlphaValue = PendingTexture.HasAlphaValue.Get();
+
+        // No garbage collection can happen while the context is alive, the texture is still valid.
+        FHoudiniEngineMaterialUtils::FinalizeUnrealTexture(
+            PendingTexture.Texture, PendingTexture.TextureParameters, bHasAlphaValue, bPreviewTextures );
+    }
+
+    PendingTextures.Empty();
 }
 
 #endif
@@ -26,6 +26,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniCookHandler.h"
 #include "ImageUtils.h"
+#include "Async/Future.h"
 
 class UTexture2D;
 class UMaterialExpression;
@@ -75,11 +76,38 @@ public:
 #if WITH_EDITOR
 
     /** Create a texture from given information. **/
+    /** If a FHoudiniTextureCreationContext is active, ImageBuffer is consumed and the texture is only finalized when the context is flushed. **/
     static UTexture2D * CreateUnrealTexture(
         UTexture2D * ExistingTexture, const HAPI_ImageInfo & ImageInfo,
         UPackage * Package, const FString & TextureName,
-        const TArray< char > & ImageBuffer, const FString & TextureType,
-        const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup, const FString& NodePath );
+        TArray< char > & ImageBuffer, const FString & TextureType,
+        const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup, const FString& NodePath,
+        const FString & InTextureHash = FString() );
+
+    /** Texture of a material component: shares a texture with identical content generated during the current cook,  **/
+    /** otherwise updates the material's own texture or creates a new one with its package.                         **/
+    /** A texture owned by another material is never reused, so its content is never overwritten.                  **/
+    static UTexture2D * ResolveGeneratedTexture(
+        FHoudiniCookParams & HoudiniCookParams, const HAPI_MaterialInfo & MaterialInfo, const FString & NodePath,
+        UTexture2D * ExistingTexture, const HAPI_ImageInfo & ImageInfo, TArray< char > & ImageBuffer,
+        const FString & TextureType, const FCreateTexture2DParameters & TextureParameters, TextureGroup LODGroup,
+        bool & bOutCreatedNewTexture );
+
+    /** Unlock the source of a texture filled by CreateUnrealTexture, apply its settings and trigger its update. **/
+    /** Preview textures are built without mipmaps and compression, their full build is deferred.               **/
+    static void FinalizeUnrealTexture(
+        UTexture2D * Texture, const FCreateTexture2DParameters & TextureParameters,
+        bool bHasAlphaValue, bool bPreviewTexture );
+
+    /** Compute the content hash of an extracted image, stored in the texture package meta information. **/
+    static FString ComputeImageBufferHash(
+        const HAPI_ImageInfo & ImageInfo, const TArray< char > & ImageBuffer,
+        const FCreateTexture2DParameters & TextureParameters );
+
+    /** Convert an interleaved 8 bit RGBA image extracted from HAPI into a vertically flipped BGRA image.   **/
+    /** Rows are processed in parallel. Returns true if bUseAlpha is set and a pixel has alpha below 0xFF. **/
+    static bool ConvertImageRGBAToBGRA(
+        const uint8 * SrcData, uint8 * DestData, int32 Width, int32 Height, bool bUseAlpha );
 
     /** Create various material components. **/
     static bool CreateMaterialComponentDiffuse(
@@ -130,4 +158,56 @@ public:
     static const int32 MaterialExpressionNodeStepX;
     static const int32 MaterialExpressionNodeStepY;
 
-};
\ No newline at end of file
+};
+
+#if WITH_EDITOR
+
+/** Scoped context deferring the pixel conversion of textures created through CreateUnrealTexture.      **/
+/** Conversions run on worker threads while the game thread keeps extracting images from HAPI; pending **/
+/** textures are finalized on the game thread when the context is flushed or goes out of scope.        **/
+/** Textures are also indexed by content hash, so identical planes resolve to a single texture.        **/
+struct HOUDINIENGINERUNTIME_API FHoudiniTextureCreationContext
+{
+public:
+    FHoudiniTextureCreationContext( bool bInPreviewTextures = false );
+    ~FHoudiniTextureCreationContext();
+
+    /** Return the innermost active context, only available on the game thread. **/
+    static FHoudiniTextureCreationContext * Get();
+
+    /** Schedule the conversion of the image into the locked mip of the texture. ImageBuffer is consumed. **/
+    void AddPendingTexture(
+        UTexture2D * Texture, uint8 * MipData, int32 Width, int32 Height,
+        TArray< char > & ImageBuffer, const FCreateTexture2DParameters & TextureParameters );
+
+    /** Return the texture generated in this context for the given content hash, if any. **/
+    UTexture2D * FindTextureByHash( const FString & TextureHash ) const;
+
+    /** Register a texture generated in this context so identical planes can share it. **/
+    void AddTextureHash( const FString & TextureHash, UTexture2D * Texture );
+
+    /** Wait for the pending conversion of the given texture, if any, and finalize it. **/
+    void FlushTexture( UTexture2D * Texture );
+
+    /** Wait for all pending conversions and finalize their textures. **/
+    void Flush();
+
+private:
+    struct FPendingTexture
+    {
+        UTexture2D * Texture = nullptr;
+        FCreateTexture2DParameters TextureParameters;
+        TFuture< bool > HasAlphaValue;
+    };
+
+    TArray< FPendingTexture > PendingTextures;
+    TMap< FString, UTexture2D * > TexturesByHash;
+    FHoudiniTextureCreationContext * PreviousContext;
+
+    /** Textures finalized by this context are previews, see UHoudiniRuntimeSettings::bDeferTemporaryTextureCompression. **/
+    bool bPreviewTextures;
+
+    static FHoudiniTextureCreationContext * CurrentContext;
+};
+
+#endif
@@ -35,7 +35,6 @@
 #include "Interfaces/IMainFrameModule.h"
 #include "ClassIconFinder.h"
 #include "ScopedTransaction.h"
-#include "RawMesh.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Interfaces/IPluginManager.h"
 #include "ISettingsModule.h"
@@ -204,6 +203,10 @@
 //#define HAPI_UNREAL_ATTRIB_LANDSCAPE_NAME               "unreal_landscape"
 #define HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME              "unreal_input_mesh_name"
 #define HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE            "unreal_input_source_file"
+#define HAPI_UNREAL_ATTRIB_INPUT_SKELETON_PATH          "unreal_input_skeleton_path"
+#define HAPI_UNREAL_ATTRIB_BONE_TRANSFORM               "transform"
+#define HAPI_UNREAL_ATTRIB_SKIN_BONE_INDICES            "unreal_skin_bone_indices"
+#define HAPI_UNREAL_ATTRIB_SKIN_BONE_WEIGHTS            "unreal_skin_bone_weights"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_PREFIX           "mesh_socket"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_NAME             "mesh_socket_name"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_NAME_OLD         "unreal_mesh_socket_name"
@@ -243,6 +246,10 @@
 #define HAPI_UNREAL_PARAM_CURVE_METHOD                  "method"
 #define HAPI_UNREAL_PARAM_CURVE_COORDS                  "coords"
 #define HAPI_UNREAL_PARAM_CURVE_CLOSED                  "close"
+#define HAPI_UNREAL_PARAM_CURVE_ORDER                   "order"
+
+/** Asset toggle enabled while cooking curve drag previews, lets HDAs lower their detail. **/
+#define HAPI_UNREAL_PARAM_CURVE_PREVIEW                 "unreal_curve_preview"
 
 #define HAPI_UNREAL_PARAM_TRANSLATE                     "t"
 #define HAPI_UNREAL_PARAM_ROTATE                        "r"
@@ -338,6 +345,12 @@
 /** Default values for new curves. **/
 #define HAPI_UNREAL_PARAM_INPUT_CURVE_COORDS_DEFAULT    "0.0, 0.0, 3.0 3.0, 0.0, 3.0"
 #define HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT     50.0f
+#define HAPI_UNREAL_PARAM_SPLINE_MAX_ERROR_DEFAULT      0.0f
+
+/** Tolerances used when sampling Unreal splines adaptively (degrees, scale and input key). **/
+#define HAPI_UNREAL_SPLINE_MAX_ROTATION_ERROR           5.0f
+#define HAPI_UNREAL_SPLINE_MAX_SCALE_ERROR              0.05f
+#define HAPI_UNREAL_SPLINE_MIN_KEY_STEP                 0.001f
 
 /** Default values for certain UI min and max parameter values **/
 #define HAPI_UNREAL_PARAM_INT_UI_MIN                    0
@@ -374,11 +387,16 @@
 #define HAPI_UNREAL_DESIRED_SETTINGS_ROW_VALUE_WIDGET_WIDTH     350
 #define HAPI_UNREAL_DESIRED_SETTINGS_ROW_FULL_WIDGET_WIDTH      400
 
+/** Number of multiparm instances the details panel builds widgets for at a time. **/
+#define HAPI_UNREAL_MULTIPARM_INSTANCES_PER_PAGE                32
+
 /** Various variable names used to store meta information in generated packages. **/
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT               TEXT( "HoudiniGeneratedObject" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_NAME                 TEXT( "HoudiniGeneratedName" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE         TEXT( "HoudiniGeneratedTextureType" )
 #define HAPI_UNREAL_PACKAGE_META_NODE_PATH                      TEXT( "HoudiniNodePath" )
+#define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_HASH         TEXT( "HoudiniGeneratedTextureHash" )
+#define HAPI_UNREAL_PACKAGE_META_GENERATED_CONTENT_HASH         TEXT( "HoudiniGeneratedContentHash" )
 
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL       TEXT( "N" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE      TEXT( "C_A" )
@@ -388,6 +406,9 @@
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE     TEXT( "E" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK TEXT( "O" )
 
+/** Delay, in seconds without new cook textures, before deferred texture builds are processed. **/
+#define HAPI_UNREAL_DEFERRED_TEXTURE_BUILD_DELAY            2.0
+
 /** Various session related settings. **/
 #define HAPI_UNREAL_SESSION_SERVER_HOST                     TEXT( "localhost" )
 #define HAPI_UNREAL_SESSION_SERVER_PORT                     9090
@@ -154,3 +154,39 @@ FHoudiniEngineString::ToFText( FText & Text ) const
 
     return false;
 }
+
+bool
+FHoudiniEngineString::ToFStringBatch( const TArray< int32 > & InStringIds, TArray< FString > & OutStrings )
+{
+    OutStrings.Empty();
+    if ( InStringIds.Num() <= 0 )
+        return true;
+
+    int32 BufferSize = 0;
+    if ( FHoudiniApi::GetStringBatchSize(
+        FHoudiniEngine::Get().GetSession(), InStringIds.GetData(),
+        InStringIds.Num(), &BufferSize ) != HAPI_RESULT_SUCCESS || BufferSize <= 0 )
+    {
+        return false;
+    }
+
+    TArray< char > Buffer;
+    Buffer.SetNumZeroed( BufferSize );
+    if ( FHoudiniApi::GetStringBatch(
+        FHoudiniEngine::Get().GetSession(), Buffer.GetData(), BufferSize ) != HAPI_RESULT_SUCCESS )
+    {
+        return false;
+    }
+
+    // Buffer holds null separated values, in the same order as the handles.
+    OutStrings.Reserve( InStringIds.Num() );
+    const char * Current = Buffer.GetData();
+    const char * End = Buffer.GetData() + BufferSize;
+    while ( Current < End && OutStrings.Num() < InStringIds.Num() )
+    {
+        OutStrings.Add( UTF8_TO_TCHAR( Current ) );
+        Current += FCStringAnsi::Strlen( Current ) + 1;
+    }
+
+    return OutStrings.Num() == InStringIds.Num();
+}
@@ -51,6 +51,9 @@
     #include "Interfaces/ITargetPlatformManagerModule.h"
     #include "Editor/UnrealEd/Private/GeomFitUtils.h"
     #include "UnrealEd/Private/ConvexDecompTool.h"
+    #include "MeshDescription.h"
+    #include "MeshDescriptionOperations.h"
+    #include "StaticMeshAttributes.h"
     #include "PackedNormal.h"
     #include "Widgets/Notifications/SNotificationList.h"
     #include "Framework/Notifications/NotificationManager.h"
@@ -67,6 +70,8 @@
 #include "Misc/Paths.h"
 #include "Materials/MaterialInterface.h"
 #include "Materials/Material.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
 
 #if PLATFORM_WINDOWS
     #include "Windows/WindowsHWrapper.h"
@@ -883,14 +888,7 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
     HAPI_PartId PartId, const char * Name)
 {
-    for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
-    {
-        if (HapiCheckAttributeExists(AssetId, ObjectId, GeoId,
-            PartId, Name, (HAPI_AttributeOwner)AttrIdx))
-            return true;
-    }
-
-    return false;
+    return HapiCheckAttributeExists( AssetId, ObjectId, GeoId, PartId, Name, HAPI_ATTROWNER_INVALID );
 }
 
 bool
@@ -900,17 +898,121 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 {
     HAPI_AttributeInfo AttribInfo;
     FHoudiniApi::AttributeInfo_Init(&AttribInfo);
-    //FMemory::Memzero< HAPI_AttributeInfo >( AttribInfo );
-    if ( FHoudiniApi::GetAttributeInfo(
-        FHoudiniEngine::Get().GetSession(),
-        GeoId, PartId, Name, Owner, &AttribInfo ) != HAPI_RESULT_SUCCESS )
-    {
+    if ( !FHoudiniEngineUtils::HapiGetAttributeInfo( GeoId, PartId, Name, Owner, AttribInfo ) )
         return false;
-    }
 
     return AttribInfo.exists;
 }
 
+bool
+FHoudiniEngineUtils::HapiGetAttributeInfo(
+    HAPI_NodeId GeoId, HAPI_PartId PartId, const char * Name,
+    HAPI_AttributeOwner Owner, HAPI_AttributeInfo & AttributeInfo )
+{
+    AttributeInfo.exists = false;
+
+    const int32 FirstOwner = ( Owner == HAPI_ATTROWNER_INVALID ) ? 0 : (int32) Owner;
+    const int32 LastOwner = ( Owner == HAPI_ATTROWNER_INVALID ) ? HAPI_ATTROWNER_MAX - 1 : (int32) Owner;
+
+    FHoudiniPartAttributeDirectory * Directory = FHoudiniScopedAttributeDirectory::FindOrAdd( GeoId, PartId );
+    if ( !Directory )
+    {
+        // No directory, probe each owner.
+        for ( int32 AttrIdx = FirstOwner; AttrIdx <= LastOwner; ++AttrIdx )
+        {
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
+                (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
+
+            if ( AttributeInfo.exists )
+                break;
+        }
+
+        return true;
+    }
+
+    // Only query the info of attributes that exist, and only once.
+    const FString AttributeName = UTF8_TO_TCHAR( Name );
+    for ( int32 AttrIdx = FirstOwner; AttrIdx <= LastOwner; ++AttrIdx )
+    {
+        if ( !Directory->Names[ AttrIdx ].Contains( AttributeName ) )
+            continue;
+
+        if ( const HAPI_AttributeInfo * FoundAttributeInfo = Directory->Infos[ AttrIdx ].Find( AttributeName ) )
+        {
+            AttributeInfo = *FoundAttributeInfo;
+            return true;
+        }
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
+            FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
+            (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
+
+        Directory->Infos[ AttrIdx ].Add( AttributeName, AttributeInfo );
+        return true;
+    }
+
+    return true;
+}
+
+int32 FHoudiniScopedAttributeDirectory::ScopeCount = 0;
+TMap< uint64, FHoudiniPartAttributeDirectory > FHoudiniScopedAttributeDirectory::Directories;
+
+FHoudiniScopedAttributeDirectory::FHoudiniScopedAttributeDirectory()
+{
+    check( IsInGameThread() );
+    ScopeCount++;
+}
+
+FHoudiniScopedAttributeDirectory::~FHoudiniScopedAttributeDirectory()
+{
+    check( IsInGameThread() );
+    if ( --ScopeCount == 0 )
+        Directories.Empty();
+}
+
+FHoudiniPartAttributeDirectory *
+FHoudiniScopedAttributeDirectory::FindOrAdd( HAPI_NodeId GeoId, HAPI_PartId PartId )
+{
+    if ( ScopeCount <= 0 || !IsInGameThread() )
+        return nullptr;
+
+    const uint64 PartKey = ( (uint64) (uint32) GeoId << 32 ) | (uint32) PartId;
+    if ( FHoudiniPartAttributeDirectory * FoundDirectory = Directories.Find( PartKey ) )
+        return FoundDirectory;
+
+    HAPI_PartInfo PartInfo;
+    FHoudiniApi::PartInfo_Init( &PartInfo );
+    if ( FHoudiniApi::GetPartInfo(
+        FHoudiniEngine::Get().GetSession(), GeoId, PartId, &PartInfo ) != HAPI_RESULT_SUCCESS )
+        return nullptr;
+
+    FHoudiniPartAttributeDirectory Directory;
+    for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
+    {
+        const int32 AttributeCount = PartInfo.attributeCounts[ AttrIdx ];
+        if ( AttributeCount <= 0 )
+            continue;
+
+        TArray< HAPI_StringHandle > AttributeNameHandles;
+        AttributeNameHandles.SetNumUninitialized( AttributeCount );
+        if ( FHoudiniApi::GetAttributeNames(
+            FHoudiniEngine::Get().GetSession(), GeoId, PartId, (HAPI_AttributeOwner) AttrIdx,
+            AttributeNameHandles.GetData(), AttributeCount ) != HAPI_RESULT_SUCCESS )
+            return nullptr;
+
+        Directory.Names[ AttrIdx ].Reserve( AttributeCount );
+        for ( const HAPI_StringHandle & AttributeNameHandle : AttributeNameHandles )
+        {
+            FString AttributeName;
+            FHoudiniEngineString( AttributeNameHandle ).ToFString( AttributeName );
+            Directory.Names[ AttrIdx ].Add( AttributeName );
+        }
+    }
+
+    return &Directories.Add( PartKey, MoveTemp( Directory ) );
+}
+
 bool
 FHoudiniEngineUtils::HapiCheckAttributeExists(
     const FHoudiniGeoPartObject & HoudiniGeoPartObject, const char * Name,
@@ -947,24 +1049,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
     FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
     //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
 
-    if ( Owner == HAPI_ATTROWNER_INVALID )
-    {
-        for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
-        {
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-                FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
-                (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
-
-            if ( AttributeInfo.exists )
-                break;
-        }
-    }
-    else
-    {
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-            FHoudiniEngine::Get().GetSession(), GeoId, PartId, Name,
-            Owner, &AttributeInfo ), false );
-    }
+    if ( !FHoudiniEngineUtils::HapiGetAttributeInfo( GeoId, PartId, Name, Owner, AttributeInfo ) )
+        return false;
 
     if ( !AttributeInfo.exists )
         return false;
@@ -1011,24 +1097,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
     FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
     //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
 
-    if ( Owner == HAPI_ATTROWNER_INVALID )
-    {
-        for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
-        {
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-                FHoudiniEngine::Get().GetSession(),
-                GeoId, PartId, Name, (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
-
-            if ( AttributeInfo.exists )
-                break;
-        }
-    }
-    else
-    {
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-            FHoudiniEngine::Get().GetSession(),
-            GeoId, PartId, Name, Owner, &AttributeInfo ), false );
-    }
+    if ( !FHoudiniEngineUtils::HapiGetAttributeInfo( GeoId, PartId, Name, Owner, AttributeInfo ) )
+        return false;
 
     if ( !AttributeInfo.exists )
         return false;
@@ -1076,24 +1146,8 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
     FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
     //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
 
-    if ( Owner == HAPI_ATTROWNER_INVALID )
-    {
-        for ( int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx )
-        {
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-                FHoudiniEngine::Get().GetSession(),
-                GeoId, PartId, Name, (HAPI_AttributeOwner) AttrIdx, &AttributeInfo ), false );
-
-            if ( AttributeInfo.exists )
-                break;
-        }
-    }
-    else
-    {
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAttributeInfo(
-            FHoudiniEngine::Get().GetSession(),
-            GeoId, PartId, Name, Owner, &AttributeInfo ), false );
-    }
+    if ( !FHoudiniEngineUtils::HapiGetAttributeInfo( GeoId, PartId, Name, Owner, AttributeInfo ) )
+        return false;
 
     if ( !AttributeInfo.exists )
         return false;
@@ -1222,22 +1276,60 @@ FHoudiniEngineUtils::PickVertexColorFromTextureMip(
 
 #if WITH_EDITOR
 
-void
-FHoudiniEngineUtils::ResetRawMesh( FRawMesh & RawMesh )
+bool
+FHoudiniEngineUtils::CommitMeshDescription( UStaticMesh * StaticMesh, int32 LODIndex, FMeshDescription && MeshDescription )
+{
+    if ( !StaticMesh || StaticMesh->IsPendingKill() || !StaticMesh->IsSourceModelValid( LODIndex ) )
+        return false;
+
+    // Replace the LOD's mesh description, instead of storing raw mesh bulk data
+    // that would be deserialized and converted again when building the mesh.
+    FMeshDescription * LODMeshDescription = StaticMesh->CreateMeshDescription( LODIndex );
+    if ( !LODMeshDescription )
+        return false;
+
+    *LODMeshDescription = MoveTemp( MeshDescription );
+
+    // Using the content hash as id lets the build of an unchanged LOD be fetched from the DDC.
+    UStaticMesh::FCommitMeshDescriptionParams CommitParams;
+    CommitParams.bMarkPackageDirty = false;
+    CommitParams.bUseHashAsGuid = true;
+    StaticMesh->CommitMeshDescription( LODIndex, CommitParams );
+
+    return true;
+}
+
+/** Material slot name of a polygon group: named slots keep their name when it is unique, others are named by index. **/
+static FName
+GetPolygonGroupMaterialSlotName( const TArray< FStaticMaterial > & StaticMaterials, int32 MaterialIndex )
+{
+    if ( StaticMaterials.IsValidIndex( MaterialIndex ) )
+    {
+        const FName & SlotName = StaticMaterials[ MaterialIndex ].ImportedMaterialSlotName;
+        bool bAlreadyUsed = false;
+        for ( int32 MaterialIdx = 0; MaterialIdx < MaterialIndex && !bAlreadyUsed; MaterialIdx++ )
+            bAlreadyUsed = StaticMaterials[ MaterialIdx ].ImportedMaterialSlotName == SlotName;
+
+        if ( SlotName != NAME_None && !bAlreadyUsed )
+            return SlotName;
+    }
+
+    return FName( *FString::FromInt( MaterialIndex ) );
+}
+
+/** Polygon group of a material, its id is the material index so the static mesh build maps it back to the material. **/
+static FPolygonGroupID
+FindOrCreatePolygonGroup( FMeshDescription & MeshDescription, const TArray< FStaticMaterial > & StaticMaterials, int32 MaterialIndex )
 {
-    // Unlike Empty this will not change memory allocations.
-
-    RawMesh.FaceMaterialIndices.Reset();
-    RawMesh.FaceSmoothingMasks.Reset();
-    RawMesh.VertexPositions.Reset();
-    RawMesh.WedgeIndices.Reset();
-    RawMesh.WedgeTangentX.Reset();
-    RawMesh.WedgeTangentY.Reset();
-    RawMesh.WedgeTangentZ.Reset();
-    RawMesh.WedgeColors.Reset();
-
-    for ( int32 Idx = 0; Idx < MAX_MESH_TEXTURE_COORDS; ++Idx )
-        RawMesh.WedgeTexCoords[ Idx ].Reset();
+    const FPolygonGroupID PolygonGroupID( FMath::Max( MaterialIndex, 0 ) );
+    if ( !MeshDescription.IsPolygonGroupValid( PolygonGroupID ) )
+    {
+        MeshDescription.CreatePolygonGroupWithID( PolygonGroupID );
+        FStaticMeshAttributes( MeshDescription ).GetPolygonGroupMaterialSlotNames()[ PolygonGroupID ] =
+            GetPolygonGroupMaterialSlotName( StaticMaterials, PolygonGroupID.GetValue() );
+    }
+
+    return PolygonGroupID;
 }
 
 #endif
@@ -1543,26 +1635,9 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         // We now have a valid id.
         ConnectedAssetId = NodeId;
     }
-    else
-    {
-        // We have to revert the Geo to its original state so we can use the Curve SOP:
-        // adding parameters to the Curve SOP locked it, preventing its parameters (type, method, isClosed) from working
-        FHoudiniApi::RevertGeo(FHoudiniEngine::Get().GetSession(), ConnectedAssetId);
-    }
-
-    //
-    // In order to be able to add rotations and scale attributes to the curve SOP, we need to cook it twice:
-    // 
-    // - First, we send the positions string to it, and cook it without refinement.
-    //   this will allow us to get the proper curve CVs, part attributes and curve info to create the desired curve.
-    //
-    // - We then need to send back all the info extracted from the curve SOP to it, and add the rotation 
-    //   and scale attributes to it. This will lock the curve SOP, and prevent the curve type and method 
-    //   parameters from functioning properly (hence why we needed the first cook to set that up)
-    //
 
     // Reading the curve parameters
-    int32 CurveTypeValue, CurveMethodValue, CurveClosed;
+    int32 CurveTypeValue, CurveMethodValue, CurveClosed, CurveOrderValue;
     FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
         ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_TYPE,
         0, CurveTypeValue);
@@ -1572,6 +1647,9 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
     FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
         ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_CLOSED,
         1, CurveClosed);
+    FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
+        ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_ORDER,
+        4, CurveOrderValue);
 
     if ( ForceClose )
     {
@@ -1583,6 +1661,178 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         CurveClosed = 1;
     }
 
+    // The curve primitive uses the order and closed state set on the curve SOP, polygons are always of order 2.
+    const bool bIsBezier = ( CurveTypeValue == HAPI_CURVETYPE_BEZIER );
+    const bool bIsPeriodic = ( CurveClosed != 0 );
+    const int32 CurveOrder = ( CurveTypeValue == HAPI_CURVETYPE_LINEAR ) ? 2 : CurveOrderValue;
+
+    // Only CVs that form a valid curve of that order can be sent as is. Otherwise the curve SOP
+    // has to adjust them, as it does for breakpoints and freehand curves.
+    bool bNeedsFitting = ( CurveMethodValue != 0 ) || ( CurveOrder < 2 ) || ( NumberOfCVs < CurveOrder );
+    if ( !bNeedsFitting && bIsBezier )
+    {
+        // Bezier segments share their end CVs, closed curves also share the first one with their last segment.
+        bNeedsFitting = ( ( bIsPeriodic ? NumberOfCVs : NumberOfCVs - 1 ) % ( CurveOrder - 1 ) ) != 0;
+    }
+
+    if ( bNeedsFitting )
+    {
+        return HapiCreateFittedCurveInputNodeForData(
+            ConnectedAssetId, Positions, Rotations, Scales3d, UniformScales,
+            CurveTypeValue, CurveMethodValue, CurveClosed );
+    }
+
+    //
+    // Our points are the curve's CVs: we can build the curve primitive the curve SOP would have created
+    // ourselves, and send it along with its attributes. The curve SOP parameters are left in place
+    // so the curve type can still be edited. The node is cooked once, by the caller.
+    //
+    const int32 CurvePointCount = NumberOfCVs;
+
+    // Attributes are only added if we have one value per input point.
+    const bool bAddRotations = Rotations && ( Rotations->Num() == NumberOfCVs );
+    const bool bAddScales3d = Scales3d && ( Scales3d->Num() == NumberOfCVs );
+    const bool bAddUniformScales = UniformScales && ( UniformScales->Num() == NumberOfCVs );
+
+    // Create the curve part.
+    HAPI_PartInfo Part;
+    FHoudiniApi::PartInfo_Init(&Part);
+    Part.id = 0;
+    Part.nameSH = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_POINT ] = 1 + bAddRotations + bAddScales3d + bAddUniformScales;
+    Part.attributeCounts[ HAPI_ATTROWNER_PRIM ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_DETAIL ] = 0;
+    Part.vertexCount = CurvePointCount;
+    Part.faceCount = 1;
+    Part.pointCount = CurvePointCount;
+    Part.type = HAPI_PARTTYPE_CURVE;
+
+    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, 0, &Part), false);
+
+    HAPI_CurveInfo CurveInfo;
+    FHoudiniApi::CurveInfo_Init(&CurveInfo);
+    CurveInfo.curveType = (HAPI_CurveType)CurveTypeValue;
+    CurveInfo.curveCount = 1;
+    CurveInfo.vertexCount = CurvePointCount;
+    CurveInfo.knotCount = 0;
+    CurveInfo.isPeriodic = bIsPeriodic;
+    CurveInfo.isRational = false;
+    CurveInfo.order = CurveOrder;
+    CurveInfo.hasKnots = false;
+
+    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveInfo(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, 0, &CurveInfo), false);
+
+    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveCounts(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, 0,
+        &CurvePointCount, 0, 1), false);
+
+    // Get runtime settings.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+
+    if ( HoudiniRuntimeSettings )
+    {
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+    }
+
+    // Create point attribute info containing positions.
+    HAPI_AttributeInfo AttributeInfoPoint;
+    FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+    AttributeInfoPoint.count = CurvePointCount;
+    AttributeInfoPoint.tupleSize = 3;
+    AttributeInfoPoint.exists = true;
+    AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+    AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+    AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, 0,
+        HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
+
+    TArray< float > CurvePositions;
+    CurvePositions.SetNumUninitialized( CurvePointCount * 3 );
+    for ( int32 Idx = 0; Idx < CurvePointCount; ++Idx )
+    {
+        FVector Position = (*Positions)[ Idx ];
+
+        if ( GeneratedGeometryScaleFactor != 0.0f )
+            Position /= GeneratedGeometryScaleFactor;
+
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            CurvePositions[ Idx * 3 + 0 ] = Position.X;
+            CurvePositions[ Idx * 3 + 1 ] = Position.Z;
+            CurvePositions[ Idx * 3 + 2 ] = Position.Y;
+        }
+        else if ( ImportAxis == HRSAI_Houdini )
+        {
+            CurvePositions[ Idx * 3 + 0 ] = Position.X;
+            CurvePositions[ Idx * 3 + 1 ] = Position.Y;
+            CurvePositions[ Idx * 3 + 2 ] = Position.Z;
+        }
+        else
+        {
+            // Not valid enum value.
+            check( 0 );
+        }
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, 0,
+        HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+        CurvePositions.GetData(), 0, AttributeInfoPoint.count), false);
+
+    if ( !HapiAddCurvePointAttributes(
+        ConnectedAssetId, CurvePointCount,
+        bAddRotations ? Rotations : nullptr,
+        bAddScales3d ? Scales3d : nullptr,
+        bAddUniformScales ? UniformScales : nullptr ) )
+        return false;
+
+    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId), false);
+
+#endif // WITH_EDITOR
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateFittedCurveInputNodeForData(
+    HAPI_NodeId ConnectedAssetId,
+    TArray<FVector>* Positions,
+    TArray<FQuat>* Rotations,
+    TArray<FVector>* Scales3d,
+    TArray<float>* UniformScales,
+    int32 CurveTypeValue,
+    int32 CurveMethodValue,
+    int32 CurveClosed)
+{
+#if WITH_EDITOR
+
+    // We have to revert the Geo to its original state so we can use the Curve SOP:
+    // adding parameters to the Curve SOP locked it, preventing its parameters (type, method, isClosed) from working
+    FHoudiniApi::RevertGeo(FHoudiniEngine::Get().GetSession(), ConnectedAssetId);
+
+    int32 NumberOfCVs = Positions->Num();
+
+    //
+    // In order to be able to add rotations and scale attributes to the curve SOP, we need to cook it twice:
+    // 
+    // - First, we send the positions string to it, and cook it without refinement.
+    //   this will allow us to get the proper curve CVs, part attributes and curve info to create the desired curve.
+    //
+    // - We then need to send back all the info extracted from the curve SOP to it, and add the rotation 
+    //   and scale attributes to it. This will lock the curve SOP, and prevent the curve type and method 
+    //   parameters from functioning properly (hence why we needed the first cook to set that up)
+    //
+
     // For closed NURBS (CVs and Breakpoints), we have to close the curve manually, by duplicating its last point
     // in order to be able to set the rotations and scales attributes properly.
     bool bCloseCurveManually = false;
@@ -1622,19 +1872,14 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         FHoudiniEngine::Get().GetSession(), ConnectedAssetId,
         ConvertedString.c_str(), ParmId, 0), false);
     
-    // If we don't want to add rotations or scale attributes to the curve, 
-    // we can just cook the node normally and stop here.
+    // If we don't want to add rotations or scale attributes to the curve,
+    // we can stop here and let the caller cook the node.
     bool bAddRotations = (Rotations != nullptr);
     bool bAddScales3d = (Scales3d != nullptr);
     bool bAddUniformScales = (UniformScales != nullptr);
 
     if (!bAddRotations && !bAddScales3d && !bAddUniformScales)
-    {
-        HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CookNode(
-            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, nullptr), false);
-
         return true;
-    }
 
     // Setting up the first cook, without the curve refinement
     HAPI_CookOptions CookOptions;
@@ -2111,30 +2356,56 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         }
     }
 
-    // Get runtime settings.
-    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
-    if (HoudiniRuntimeSettings)
-        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
-
     // We can add attributes to the curve now that all the curves attributes
     // and properties have been reset.
-    if (bAddRotations)
-    {
-        // Create ROTATION attribute info
-        HAPI_AttributeInfo AttributeInfoRotation;
-        FHoudiniApi::AttributeInfo_Init(&AttributeInfoRotation);
+    if ( !HapiAddCurvePointAttributes(
+        ConnectedAssetId, NumberOfCVs,
+        bAddRotations ? Rotations : nullptr,
+        bAddScales3d ? Scales3d : nullptr,
+        bAddUniformScales ? UniformScales : nullptr ) )
+        return false;
+
+    // Finally, commit the geo ...
+    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId), false);
+
+#endif // WITH_EDITOR
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiAddCurvePointAttributes(
+    HAPI_NodeId NodeId,
+    int32 NumberOfCVs,
+    const TArray<FQuat>* Rotations,
+    const TArray<FVector>* Scales3d,
+    const TArray<float>* UniformScales)
+{
+#if WITH_EDITOR
+
+    // Get runtime settings.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+    if (HoudiniRuntimeSettings)
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+
+    if (Rotations)
+    {
+        // Create ROTATION attribute info
+        HAPI_AttributeInfo AttributeInfoRotation;
+        FHoudiniApi::AttributeInfo_Init(&AttributeInfoRotation);
         //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoRotation );
         AttributeInfoRotation.count = NumberOfCVs;
         AttributeInfoRotation.tupleSize = 4;
         AttributeInfoRotation.exists = true;
-        AttributeInfoRotation.owner = NewAttributesOwner;
+        AttributeInfoRotation.owner = HAPI_ATTROWNER_POINT;
         AttributeInfoRotation.storage = HAPI_STORAGETYPE_FLOAT;
-        AttributeInfoRotation.originalOwner = OriginalAttributesOwner;
+        AttributeInfoRotation.originalOwner = HAPI_ATTROWNER_POINT;
 
         HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
             FHoudiniEngine::Get().GetSession(), 
-            ConnectedAssetId, 0,
+            NodeId, 0,
             HAPI_UNREAL_ATTRIB_ROTATION,
             &AttributeInfoRotation), false);
 
@@ -2170,7 +2441,7 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         //we can now upload them to our attribute.
         HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
             FHoudiniEngine::Get().GetSession(), 
-            ConnectedAssetId, 0,
+            NodeId, 0,
             HAPI_UNREAL_ATTRIB_ROTATION, 
             &AttributeInfoRotation,
             CurveRotations.GetData(),
@@ -2178,7 +2449,7 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
     }
 
     // Create SCALE attribute info.
-    if (bAddScales3d)
+    if (Scales3d)
     {
         HAPI_AttributeInfo AttributeInfoScale;
         FHoudiniApi::AttributeInfo_Init(&AttributeInfoScale);
@@ -2186,13 +2457,13 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         AttributeInfoScale.count = NumberOfCVs;
         AttributeInfoScale.tupleSize = 3;
         AttributeInfoScale.exists = true;
-        AttributeInfoScale.owner = NewAttributesOwner;
+        AttributeInfoScale.owner = HAPI_ATTROWNER_POINT;
         AttributeInfoScale.storage = HAPI_STORAGETYPE_FLOAT;
-        AttributeInfoScale.originalOwner = OriginalAttributesOwner;
+        AttributeInfoScale.originalOwner = HAPI_ATTROWNER_POINT;
 
         HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
             FHoudiniEngine::Get().GetSession(), 
-            ConnectedAssetId, 0,
+            NodeId, 0,
             HAPI_UNREAL_ATTRIB_SCALE, 
             &AttributeInfoScale), false);
 
@@ -2225,7 +2496,7 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         // We can now upload them to our attribute.
         HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
             FHoudiniEngine::Get().GetSession(), 
-            ConnectedAssetId, 0, 
+            NodeId, 0, 
             HAPI_UNREAL_ATTRIB_SCALE, 
             &AttributeInfoScale,
             CurveScales.GetData(),
@@ -2233,7 +2504,7 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
     }
 
     // Create PSCALE attribute info.
-    if (bAddUniformScales)
+    if (UniformScales)
     {
         HAPI_AttributeInfo AttributeInfoPScale;
         FHoudiniApi::AttributeInfo_Init(&AttributeInfoPScale);
@@ -2241,13 +2512,13 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         AttributeInfoPScale.count = NumberOfCVs;
         AttributeInfoPScale.tupleSize = 1;
         AttributeInfoPScale.exists = true;
-        AttributeInfoPScale.owner = NewAttributesOwner;
+        AttributeInfoPScale.owner = HAPI_ATTROWNER_POINT;
         AttributeInfoPScale.storage = HAPI_STORAGETYPE_FLOAT;
-        AttributeInfoPScale.originalOwner = OriginalAttributesOwner;
+        AttributeInfoPScale.originalOwner = HAPI_ATTROWNER_POINT;
 
         HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
             FHoudiniEngine::Get().GetSession(), 
-            ConnectedAssetId, 0,
+            NodeId, 0,
             HAPI_UNREAL_ATTRIB_UNIFORM_SCALE, 
             &AttributeInfoPScale), false);
 
@@ -2262,17 +2533,14 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         // We can now upload them to our attribute.
         HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
             FHoudiniEngine::Get().GetSession(), 
-            ConnectedAssetId, 0,
+            NodeId, 0,
             HAPI_UNREAL_ATTRIB_UNIFORM_SCALE, 
             &AttributeInfoPScale,
             CurvePScales.GetData(), 
             0, AttributeInfoPScale.count), false);
     }
 
-    // Finally, commit the geo ...
-    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-        FHoudiniEngine::Get().GetSession(), ConnectedAssetId), false);
-#endif
+#endif // WITH_EDITOR
 
     return true;
 }
@@ -2703,81 +2971,239 @@ FHoudiniEngineUtils::HapiCreateInputNodeForLandscape(
 }
 
 
-bool
-FHoudiniEngineUtils::HapiCreateInputNodeForSpline(
-    HAPI_NodeId HostAssetId, 
-    USplineComponent * SplineComponent,
-    HAPI_NodeId & ConnectedAssetId,
-    FHoudiniAssetInputOutlinerMesh& OutlinerMesh,
-    const float& SplineResolution )
+float
+FHoudiniEngineUtils::GetMarshallingSplineResolution( const float & SplineResolution )
 {
-#if WITH_EDITOR
+    if ( SplineResolution != -1.0f )
+        return SplineResolution;
 
-    // If we don't have a spline component, or host asset is invalid, there's nothing to do.
-    if ( !SplineComponent || SplineComponent->IsPendingKill() || !FHoudiniEngineUtils::IsHoudiniNodeValid( HostAssetId ) )
-        return false;
-        
-    float fSplineResolution = SplineResolution;
-    if (fSplineResolution == -1.0f)
+    // Get runtime settings and extract the spline resolution from it
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+        return HoudiniRuntimeSettings->MarshallingSplineResolution;
+
+    return HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
+}
+
+float
+FHoudiniEngineUtils::GetMarshallingSplineMaxError()
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+        return HoudiniRuntimeSettings->MarshallingSplineMaxError;
+
+    return HAPI_UNREAL_PARAM_SPLINE_MAX_ERROR_DEFAULT;
+}
+
+uint32
+FHoudiniEngineUtils::GetSplineSamplingHash(
+    const USplineComponent * SplineComponent, const float & SplineResolution, const float & SplineMaxError )
+{
+    uint32 Hash = FCrc::MemCrc32( &SplineResolution, sizeof( float ) );
+    Hash = FCrc::MemCrc32( &SplineMaxError, sizeof( float ), Hash );
+
+    if ( !SplineComponent )
+        return Hash;
+
+    const bool bClosedLoop = SplineComponent->IsClosedLoop();
+    Hash = FCrc::MemCrc32( &bClosedLoop, sizeof( bool ), Hash );
+    Hash = FCrc::MemCrc32( &SplineComponent->DefaultUpVector, sizeof( FVector ), Hash );
+
+    // The sampled rotations are in world space.
+    const FQuat ComponentRotation = SplineComponent->GetComponentTransform().GetRotation();
+    Hash = FCrc::MemCrc32( &ComponentRotation, sizeof( FQuat ), Hash );
+
+    // Hash the keys member by member, the points have padding.
+    auto HashCurve = [ &Hash ]( const auto & Curve )
     {
-        // Get runtime settings and extract the spline resolution from it
-        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-        if (HoudiniRuntimeSettings)
-            fSplineResolution = HoudiniRuntimeSettings->MarshallingSplineResolution;
-        else
-            fSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
-    }
+        for ( const auto & Point : Curve.Points )
+        {
+            const uint8 InterpMode = Point.InterpMode;
+            Hash = FCrc::MemCrc32( &Point.InVal, sizeof( Point.InVal ), Hash );
+            Hash = FCrc::MemCrc32( &Point.OutVal, sizeof( Point.OutVal ), Hash );
+            Hash = FCrc::MemCrc32( &Point.ArriveTangent, sizeof( Point.ArriveTangent ), Hash );
+            Hash = FCrc::MemCrc32( &Point.LeaveTangent, sizeof( Point.LeaveTangent ), Hash );
+            Hash = FCrc::MemCrc32( &InterpMode, sizeof( uint8 ), Hash );
+        }
+    };
 
-    int32 nNumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
-    float fSplineLength = SplineComponent->GetSplineLength();  
+    HashCurve( SplineComponent->SplineCurves.Position );
+    HashCurve( SplineComponent->SplineCurves.Rotation );
+    HashCurve( SplineComponent->SplineCurves.Scale );
+
+    return Hash;
+}
+
+void
+FHoudiniEngineUtils::SampleSpline(
+    const USplineComponent * SplineComponent, const float & SplineResolution, const float & SplineMaxError,
+    FHoudiniSplineSamples & OutSamples )
+{
+    OutSamples.Positions.Reset();
+    OutSamples.Rotations.Reset();
+    OutSamples.Scales.Reset();
+    OutSamples.Hash = GetSplineSamplingHash( SplineComponent, SplineResolution, SplineMaxError );
+
+    if ( !SplineComponent )
+        return;
+
+    int32 NumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+    float SplineLength = SplineComponent->GetSplineLength();
 
     // Calculate the number of refined point we want
-    int32 nNumberOfRefinedSplinePoints = fSplineResolution > 0.0f ? ceil(fSplineLength / fSplineResolution) + 1 : nNumberOfControlPoints;
-    
-    // Array that will store the attributes we want to add to the curves
-    TArray<FVector> tRefinedSplinePositions;
-    TArray<FQuat> tRefinedSplineRotations;    
-    // Scale on Unreal's spline will require some tweaking, as the XScale is always 1
-    TArray<FVector> tRefinedSplineScales;
+    int32 NumberOfRefinedSplinePoints = SplineResolution > 0.0f ? ceil( SplineLength / SplineResolution ) + 1 : NumberOfControlPoints;
 
-    if ( (nNumberOfRefinedSplinePoints < nNumberOfControlPoints) || (fSplineResolution <= 0.0f) )
+    if ( ( NumberOfRefinedSplinePoints < NumberOfControlPoints ) || ( SplineResolution <= 0.0f ) )
     {
         // There's not enough refined points, so we'll use the Spline CVs instead
-        tRefinedSplinePositions.SetNumZeroed(nNumberOfControlPoints);
-        tRefinedSplineRotations.SetNumZeroed(nNumberOfControlPoints);
-        tRefinedSplineScales.SetNumZeroed(nNumberOfControlPoints);
+        OutSamples.Positions.SetNumZeroed( NumberOfControlPoints );
+        OutSamples.Rotations.SetNumZeroed( NumberOfControlPoints );
+        OutSamples.Scales.SetNumZeroed( NumberOfControlPoints );
+
+        for ( int32 n = 0; n < NumberOfControlPoints; n++ )
+        {
+            OutSamples.Positions[ n ] = SplineComponent->GetLocationAtSplinePoint( n, ESplineCoordinateSpace::Local );
+            OutSamples.Rotations[ n ] = SplineComponent->GetQuaternionAtSplinePoint( n, ESplineCoordinateSpace::World );
+            OutSamples.Scales[ n ] = SplineComponent->GetScaleAtSplinePoint( n );
+        }
+    }
+    else if ( SplineMaxError > 0.0f )
+    {
+        // Adaptive sampling: each segment between two CVs is split in halves until the curve stays within
+        // SplineMaxError of the samples, straight segments only keep their CVs. Halves shorter than the
+        // resolution are not split any further.
+        struct FSplineSample
+        {
+            float Key;
+            FVector Position;
+            FQuat Rotation;
+            FVector Scale;
+        };
+
+        auto Sample = [ SplineComponent ]( const float & Key )
+        {
+            FSplineSample SplineSample;
+            SplineSample.Key = Key;
+            SplineSample.Position = SplineComponent->GetLocationAtSplineInputKey( Key, ESplineCoordinateSpace::Local );
+            SplineSample.Rotation = SplineComponent->GetQuaternionAtSplineInputKey( Key, ESplineCoordinateSpace::World );
+            SplineSample.Scale = SplineComponent->GetScaleAtSplineInputKey( Key );
+            return SplineSample;
+        };
+
+        auto AddSample = [ &OutSamples ]( const FSplineSample & SplineSample )
+        {
+            OutSamples.Positions.Add( SplineSample.Position );
+            OutSamples.Rotations.Add( SplineSample.Rotation );
+            OutSamples.Scales.Add( SplineSample.Scale );
+        };
+
+        // Checking the quarter points as well as the middle catches S-shaped segments.
+        const float MaxRotationError = FMath::DegreesToRadians( HAPI_UNREAL_SPLINE_MAX_ROTATION_ERROR );
+        auto IsWithinError = [ & ]( const FSplineSample & Start, const FSplineSample & End )
+        {
+            for ( const float Alpha : { 0.25f, 0.5f, 0.75f } )
+            {
+                const FSplineSample Middle = Sample( FMath::Lerp( Start.Key, End.Key, Alpha ) );
+                if ( FVector::Dist( Middle.Position, FMath::Lerp( Start.Position, End.Position, Alpha ) ) > SplineMaxError )
+                    return false;
+
+                if ( Middle.Rotation.AngularDistance( FQuat::Slerp( Start.Rotation, End.Rotation, Alpha ) ) > MaxRotationError )
+                    return false;
+
+                if ( !Middle.Scale.Equals( FMath::Lerp( Start.Scale, End.Scale, Alpha ), HAPI_UNREAL_SPLINE_MAX_SCALE_ERROR ) )
+                    return false;
+            }
 
-        FVector Scale;
-        for (int32 n = 0; n < nNumberOfControlPoints; n++)
+            return true;
+        };
+
+        const bool bClosedLoop = SplineComponent->IsClosedLoop();
+        const int32 NumberOfSegments = bClosedLoop ? NumberOfControlPoints : NumberOfControlPoints - 1;
+
+        // Depth first: the stack holds the pending ends of the current segment, closest one on top.
+        TArray< FSplineSample > PendingEnds;
+        FSplineSample Current = Sample( 0.0f );
+        for ( int32 SegmentIdx = 0; SegmentIdx < NumberOfSegments; SegmentIdx++ )
         {
-            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
-            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
+            AddSample( Current );
+
+            PendingEnds.Reset();
+            PendingEnds.Push( Sample( (float) ( SegmentIdx + 1 ) ) );
+            while ( PendingEnds.Num() > 0 )
+            {
+                const FSplineSample & End = PendingEnds.Last();
+                if ( FVector::Dist( Current.Position, End.Position ) > SplineResolution
+                    && End.Key - Current.Key > HAPI_UNREAL_SPLINE_MIN_KEY_STEP
+                    && !IsWithinError( Current, End ) )
+                {
+                    const float MiddleKey = 0.5f * ( Current.Key + End.Key );
+                    PendingEnds.Push( Sample( MiddleKey ) );
+                    continue;
+                }
 
-            Scale = SplineComponent->GetScaleAtSplinePoint(n);
-            tRefinedSplineScales[n] = Scale;
+                // The segment's end is added as the next segment's start.
+                Current = PendingEnds.Pop( false );
+                if ( PendingEnds.Num() > 0 )
+                    AddSample( Current );
+            }
         }
+
+        // Closed loops end on their first CV, which is already there.
+        if ( !bClosedLoop )
+            AddSample( Current );
     }
     else
     {
         // Calculating the refined spline points
-        tRefinedSplinePositions.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        tRefinedSplineRotations.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        tRefinedSplineScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        OutSamples.Positions.SetNumZeroed( NumberOfRefinedSplinePoints );
+        OutSamples.Rotations.SetNumZeroed( NumberOfRefinedSplinePoints );
+        OutSamples.Scales.SetNumZeroed( NumberOfRefinedSplinePoints );
 
-        FVector Scale;
-        float fCurrentDistance = 0.0f;
-        for (int32 n = 0; n < nNumberOfRefinedSplinePoints; n++)
+        float CurrentDistance = 0.0f;
+        for ( int32 n = 0; n < NumberOfRefinedSplinePoints; n++ )
         {
-            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::Local);
-            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::World);
-            
-            Scale = SplineComponent->GetScaleAtDistanceAlongSpline(fCurrentDistance);
+            OutSamples.Positions[ n ] = SplineComponent->GetLocationAtDistanceAlongSpline( CurrentDistance, ESplineCoordinateSpace::Local );
+            OutSamples.Rotations[ n ] = SplineComponent->GetQuaternionAtDistanceAlongSpline( CurrentDistance, ESplineCoordinateSpace::World );
+            OutSamples.Scales[ n ] = SplineComponent->GetScaleAtDistanceAlongSpline( CurrentDistance );
 
-            tRefinedSplineScales[n] = Scale;
-
-            fCurrentDistance += fSplineResolution;
+            CurrentDistance += SplineResolution;
         }
     }
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForSpline(
+    HAPI_NodeId HostAssetId, 
+    USplineComponent * SplineComponent,
+    HAPI_NodeId & ConnectedAssetId,
+    FHoudiniAssetInputOutlinerMesh& OutlinerMesh,
+    const float& SplineResolution )
+{
+#if WITH_EDITOR
+
+    // If we don't have a spline component, or host asset is invalid, there's nothing to do.
+    if ( !SplineComponent || SplineComponent->IsPendingKill() || !FHoudiniEngineUtils::IsHoudiniNodeValid( HostAssetId ) )
+        return false;
+        
+    const float fSplineResolution = GetMarshallingSplineResolution( SplineResolution );
+    const float fSplineMaxError = GetMarshallingSplineMaxError();
+
+    int32 nNumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+    float fSplineLength = SplineComponent->GetSplineLength();  
+
+    // Sample the spline, unless the outliner mesh still holds samples (usually computed in parallel
+    // by HapiCreateInputNodeForWorldOutliner) matching its current control points and settings.
+    if ( OutlinerMesh.SplineSamples.Positions.Num() <= 0
+        || OutlinerMesh.SplineSamples.Hash != GetSplineSamplingHash( SplineComponent, fSplineResolution, fSplineMaxError ) )
+    {
+        SampleSpline( SplineComponent, fSplineResolution, fSplineMaxError, OutlinerMesh.SplineSamples );
+    }
+
+    // Array that will store the attributes we want to add to the curves
+    TArray<FVector> tRefinedSplinePositions = OutlinerMesh.SplineSamples.Positions;
+    TArray<FQuat> tRefinedSplineRotations = OutlinerMesh.SplineSamples.Rotations;
+    // Scale on Unreal's spline will require some tweaking, as the XScale is always 1
+    TArray<FVector> tRefinedSplineScales = OutlinerMesh.SplineSamples.Scales;
 
     if ( !HapiCreateCurveInputNodeForData(
             HostAssetId, 
@@ -2791,6 +3217,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSpline(
 
     // Updating the OutlinerMesh's struct infos
     OutlinerMesh.SplineResolution = fSplineResolution;
+    OutlinerMesh.SplineMaxError = fSplineMaxError;
     OutlinerMesh.SplineLength = fSplineLength;
     OutlinerMesh.NumberOfSplineControlPoints = nNumberOfControlPoints;
 
@@ -2928,9 +3355,51 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             CurrentLODNodeId = ConnectedAssetId;
         }
 
-        // Load the existing raw mesh.
-        FRawMesh RawMesh;
-        SrcModel.LoadRawMesh(RawMesh);
+        // Read the LOD's geometry straight from its mesh description.
+        FMeshDescription EmptyMeshDescription;
+        const FMeshDescription * MeshDescription = StaticMesh->GetMeshDescription( LODIndex );
+        if ( !MeshDescription )
+        {
+            FStaticMeshAttributes( EmptyMeshDescription ).Register();
+            MeshDescription = &EmptyMeshDescription;
+        }
+
+        FStaticMeshConstAttributes MeshAttributes( *MeshDescription );
+        TVertexAttributesConstRef< FVector > VertexPositions = MeshAttributes.GetVertexPositions();
+        TVertexInstanceAttributesConstRef< FVector > VertexInstanceNormals = MeshAttributes.GetVertexInstanceNormals();
+        TVertexInstanceAttributesConstRef< FVector > VertexInstanceTangents = MeshAttributes.GetVertexInstanceTangents();
+        TVertexInstanceAttributesConstRef< float > VertexInstanceBinormalSigns = MeshAttributes.GetVertexInstanceBinormalSigns();
+        TVertexInstanceAttributesConstRef< FVector4 > VertexInstanceColors = MeshAttributes.GetVertexInstanceColors();
+        TVertexInstanceAttributesConstRef< FVector2D > VertexInstanceUVs = MeshAttributes.GetVertexInstanceUVs();
+        TPolygonGroupAttributesConstRef< FName > PolygonGroupMaterialSlotNames = MeshAttributes.GetPolygonGroupMaterialSlotNames();
+
+        // Points are numbered in the order of the description's vertices, skipping the ids of deleted ones.
+        TArray< int32 > VertexPointIndices;
+        VertexPointIndices.Init( INDEX_NONE, MeshDescription->Vertices().GetArraySize() );
+        TArray< FVertexID > PointVertexIDs;
+        PointVertexIDs.Reserve( MeshDescription->Vertices().Num() );
+        for ( const FVertexID VertexID : MeshDescription->Vertices().GetElementIDs() )
+            VertexPointIndices[ VertexID.GetValue() ] = PointVertexIDs.Add( VertexID );
+
+        // The vertex instances of every triangle's wedges, in Houdini's winding order.
+        static const int32 UnrealWedgeOrder[ 3 ] = { 0, 2, 1 };
+        static const int32 HoudiniWedgeOrder[ 3 ] = { 0, 1, 2 };
+        const int32 * WedgeOrder = ( ImportAxis == HRSAI_Unreal ) ? UnrealWedgeOrder : HoudiniWedgeOrder;
+
+        TArray< FVertexInstanceID > WedgeVertexInstanceIDs;
+        TArray< FPolygonID > FacePolygonIDs;
+        for ( const FPolygonID PolygonID : MeshDescription->Polygons().GetElementIDs() )
+        {
+            for ( const FMeshTriangle & Triangle : MeshDescription->GetPolygonTriangles( PolygonID ) )
+            {
+                for ( int32 CornerIdx = 0; CornerIdx < 3; ++CornerIdx )
+                    WedgeVertexInstanceIDs.Add( Triangle.GetVertexInstanceID( WedgeOrder[ CornerIdx ] ) );
+
+                FacePolygonIDs.Add( PolygonID );
+            }
+        }
+
+        const int32 WedgeCount = WedgeVertexInstanceIDs.Num();
 
         // Create part.
         HAPI_PartInfo Part;
@@ -2942,9 +3411,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         Part.attributeCounts[ HAPI_ATTROWNER_PRIM ] = 0;
         Part.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 0;
         Part.attributeCounts[ HAPI_ATTROWNER_DETAIL ] = 0;
-        Part.vertexCount = RawMesh.WedgeIndices.Num();
-        Part.faceCount = RawMesh.WedgeIndices.Num() / 3;
-        Part.pointCount = RawMesh.VertexPositions.Num();
+        Part.vertexCount = WedgeCount;
+        Part.faceCount = FacePolygonIDs.Num();
+        Part.pointCount = PointVertexIDs.Num();
         Part.type = HAPI_PARTTYPE_MESH;
 
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
@@ -2954,7 +3423,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         HAPI_AttributeInfo AttributeInfoPoint;
         FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
         //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPoint );
-        AttributeInfoPoint.count = RawMesh.VertexPositions.Num();
+        AttributeInfoPoint.count = PointVertexIDs.Num();
         AttributeInfoPoint.tupleSize = 3;
         AttributeInfoPoint.exists = true;
         AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
@@ -2970,11 +3439,11 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
 
         // Extract vertices from static mesh.
         TArray< float > StaticMeshVertices;
-        StaticMeshVertices.SetNumZeroed( RawMesh.VertexPositions.Num() * 3 );
-        for ( int32 VertexIdx = 0; VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx )
+        StaticMeshVertices.SetNumZeroed( PointVertexIDs.Num() * 3 );
+        for ( int32 VertexIdx = 0; VertexIdx < PointVertexIDs.Num(); ++VertexIdx )
         {
             // Grab vertex at this index.
-            const FVector & PositionVector = RawMesh.VertexPositions[ VertexIdx ];
+            const FVector & PositionVector = VertexPositions[ PointVertexIDs[ VertexIdx ] ];
 
             if ( ImportAxis == HRSAI_Unreal )
             {
@@ -3003,85 +3472,56 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             AttributeInfoPoint.count ), false );
 
         // See if we have texture coordinates to upload.
-        for ( int32 MeshTexCoordIdx = 0; MeshTexCoordIdx < MAX_STATIC_TEXCOORDS; ++MeshTexCoordIdx )
+        const int32 MeshTexCoordCount = WedgeCount > 0 ? FMath::Min( VertexInstanceUVs.GetNumIndices(), (int32) MAX_STATIC_TEXCOORDS ) : 0;
+        for ( int32 MeshTexCoordIdx = 0; MeshTexCoordIdx < MeshTexCoordCount; ++MeshTexCoordIdx )
         {
-            int32 StaticMeshUVCount = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ].Num();
-
-            if ( StaticMeshUVCount > 0 )
+            // Transfer UV data, the wedges are already in Houdini's winding order.
+            TArray< FVector > StaticMeshUVs;
+            StaticMeshUVs.Reserve( WedgeCount );
+            for ( const FVertexInstanceID & VertexInstanceID : WedgeVertexInstanceIDs )
             {
-                const TArray< FVector2D > & RawMeshUVs = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ];
-                TArray< FVector > StaticMeshUVs;
-                StaticMeshUVs.Reserve( StaticMeshUVCount );
-
-                // Transfer UV data.
-                for ( int32 UVIdx = 0; UVIdx < StaticMeshUVCount; ++UVIdx )
-                    StaticMeshUVs.Emplace( RawMeshUVs[ UVIdx ].X, 1.0 - RawMeshUVs[ UVIdx ].Y, 0 );
-
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    // We need to re-index UVs for wedges we swapped (due to winding differences).
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                    {
-                        // We do not touch wedge 0 of this triangle.
-                        StaticMeshUVs.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-                    }
-                }
-                else if ( ImportAxis == HRSAI_Houdini )
-                {
-                    // Do nothing, data is in proper format.
-                }
-                else
-                {
-                    // Not valid enum value.
-                    check( 0 );
-                }
+                const FVector2D & UV = VertexInstanceUVs.Get( VertexInstanceID, MeshTexCoordIdx );
+                StaticMeshUVs.Emplace( UV.X, 1.0 - UV.Y, 0 );
+            }
 
-                // Construct attribute name for this index.
-                FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
+            // Construct attribute name for this index.
+            FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
 
-                if ( MeshTexCoordIdx > 0 )
-                    UVAttributeName += FString::Printf(TEXT("%d"), MeshTexCoordIdx + 1);
+            if ( MeshTexCoordIdx > 0 )
+                UVAttributeName += FString::Printf(TEXT("%d"), MeshTexCoordIdx + 1);
 
-                // Create attribute for UVs
-                HAPI_AttributeInfo AttributeInfoVertex;
-                FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
-                //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
-                AttributeInfoVertex.count = StaticMeshUVCount;
-                AttributeInfoVertex.tupleSize = 3;
-                AttributeInfoVertex.exists = true;
-                AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-                AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-                AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+            // Create attribute for UVs
+            HAPI_AttributeInfo AttributeInfoVertex;
+            FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
+            //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
+            AttributeInfoVertex.count = StaticMeshUVs.Num();
+            AttributeInfoVertex.tupleSize = 3;
+            AttributeInfoVertex.exists = true;
+            AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+            AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+            AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
-                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-                    FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
-                    0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex ), false );
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+                FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
+                0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex ), false );
 
-                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-                    FHoudiniEngine::Get().GetSession(),
-                    CurrentLODNodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex,
-                    (const float *) StaticMeshUVs.GetData(), 0, AttributeInfoVertex.count ), false );
-            }
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+                FHoudiniEngine::Get().GetSession(),
+                CurrentLODNodeId, 0, TCHAR_TO_ANSI(*UVAttributeName), &AttributeInfoVertex,
+                (const float *) StaticMeshUVs.GetData(), 0, AttributeInfoVertex.count ), false );
         }
 
         // See if we have normals to upload.
-        if ( RawMesh.WedgeTangentZ.Num() > 0 )
+        if ( WedgeCount > 0 )
         {
-            TArray< FVector > ChangedNormals( RawMesh.WedgeTangentZ );
-            if ( ImportAxis == HRSAI_Unreal )
+            TArray< FVector > ChangedNormals;
+            ChangedNormals.SetNumUninitialized( WedgeCount );
+            for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; ++WedgeIdx )
             {
-                // We need to re-index normals for wedges we swapped (due to winding differences).
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                {
-                    FVector TangentZ1 = ChangedNormals[ WedgeIdx + 1 ];
-                    FVector TangentZ2 = ChangedNormals[ WedgeIdx + 2 ];
-
-                    ChangedNormals[ WedgeIdx + 1 ] = TangentZ2;
-                    ChangedNormals[ WedgeIdx + 2 ] = TangentZ1;
-                }
+                ChangedNormals[ WedgeIdx ] = VertexInstanceNormals[ WedgeVertexInstanceIDs[ WedgeIdx ] ];
 
-                // We also need to swap the vector's Y and Z components
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
+                // We need to swap the vector's Y and Z components
+                if ( ImportAxis == HRSAI_Unreal )
                     Swap( ChangedNormals[ WedgeIdx ].Y, ChangedNormals[ WedgeIdx ].Z );
             }
 
@@ -3107,25 +3547,27 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 0, AttributeInfoVertex.count ), false );
         }
 
-        // See if we have tangentu to upload.
-        if (RawMesh.WedgeTangentX.Num() > 0)
+        // See if we have tangentu and tangentv to upload.
+        if ( WedgeCount > 0 )
         {
-            TArray< FVector > ChangedTangentU(RawMesh.WedgeTangentX);
-            if (ImportAxis == HRSAI_Unreal)
+            // The binormal is rebuilt from the normal, the tangent and the sign of the basis.
+            TArray< FVector > ChangedTangentU;
+            TArray< FVector > ChangedTangentV;
+            ChangedTangentU.SetNumUninitialized( WedgeCount );
+            ChangedTangentV.SetNumUninitialized( WedgeCount );
+            for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; ++WedgeIdx )
             {
-                // We need to re-index tangents for wedges we swapped (due to winding differences).
-                for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3)
-                {
-                    FVector TangentU1 = ChangedTangentU[WedgeIdx + 1];
-                    FVector TangentU2 = ChangedTangentU[WedgeIdx + 2];
+                const FVertexInstanceID & VertexInstanceID = WedgeVertexInstanceIDs[ WedgeIdx ];
+                ChangedTangentU[ WedgeIdx ] = VertexInstanceTangents[ VertexInstanceID ];
+                ChangedTangentV[ WedgeIdx ] = FVector::CrossProduct( VertexInstanceNormals[ VertexInstanceID ], ChangedTangentU[ WedgeIdx ] ).GetSafeNormal()
+                    * VertexInstanceBinormalSigns[ VertexInstanceID ];
 
-                    ChangedTangentU[WedgeIdx + 1] = TangentU2;
-                    ChangedTangentU[WedgeIdx + 2] = TangentU1;
+                // We need to swap the vector's Y and Z components
+                if ( ImportAxis == HRSAI_Unreal )
+                {
+                    Swap( ChangedTangentU[ WedgeIdx ].Y, ChangedTangentU[ WedgeIdx ].Z );
+                    Swap( ChangedTangentV[ WedgeIdx ].Y, ChangedTangentV[ WedgeIdx ].Z );
                 }
-
-                // We also need to swap the vector's Y and Z components
-                for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx)
-                    Swap(ChangedTangentU[WedgeIdx].Y, ChangedTangentU[WedgeIdx].Z);
             }
 
             // Create attribute for tangentu.
@@ -3148,39 +3590,8 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 CurrentLODNodeId, 0, HAPI_UNREAL_ATTRIB_TANGENTU, &AttributeInfoVertex,
                 (const float *)ChangedTangentU.GetData(),
                 0, AttributeInfoVertex.count), false);
-        }
-
-        // See if we have tangentv to upload.
-        if (RawMesh.WedgeTangentY.Num() > 0)
-        {
-            TArray< FVector > ChangedTangentV(RawMesh.WedgeTangentY);
-            if (ImportAxis == HRSAI_Unreal)
-            {
-                // We need to re-index normals for wedges we swapped (due to winding differences).
-                for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3)
-                {
-                    FVector TangentV1 = ChangedTangentV[WedgeIdx + 1];
-                    FVector TangentV2 = ChangedTangentV[WedgeIdx + 2];
-
-                    ChangedTangentV[WedgeIdx + 1] = TangentV2;
-                    ChangedTangentV[WedgeIdx + 2] = TangentV1;
-                }
-
-                for (int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx)
-                    Swap(ChangedTangentV[WedgeIdx].Y, ChangedTangentV[WedgeIdx].Z);
-            }
-
-            // Create attribute for normals.
-            HAPI_AttributeInfo AttributeInfoVertex;
-            FHoudiniApi::AttributeInfo_Init(&AttributeInfoVertex);
-            //FMemory::Memzero< HAPI_AttributeInfo >(AttributeInfoVertex);
-            AttributeInfoVertex.count = ChangedTangentV.Num();
-            AttributeInfoVertex.tupleSize = 3;
-            AttributeInfoVertex.exists = true;
-            AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-            AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-            AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
 
+            // Create attribute for tangentv.
             HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
                 FHoudiniEngine::Get().GetSession(), CurrentLODNodeId,
                 0, HAPI_UNREAL_ATTRIB_TANGENTV, &AttributeInfoVertex), false);
@@ -3193,9 +3604,15 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         }
 
         {
-            // If we have instance override vertex colors, first propagate them to our copy of 
-            // the RawMesh Vert Colors
+            // Vertex colors are stored quantized, as the static mesh's vertex colors.
             TArray< FLinearColor > ChangedColors;
+            ChangedColors.SetNumUninitialized( WedgeCount );
+            for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; ++WedgeIdx )
+            {
+                ChangedColors[ WedgeIdx ] = FLinearColor( VertexInstanceColors[ WedgeVertexInstanceIDs[ WedgeIdx ] ] ).ToFColor( true ).ReinterpretAsLinear();
+            }
+
+            // If we have instance override vertex colors, they replace the mesh's colors
             if ( StaticMeshComponent &&
                 StaticMeshComponent->LODData.IsValidIndex( LODIndex ) &&
                 StaticMeshComponent->LODData[LODIndex].OverrideVertexColors &&
@@ -3209,59 +3626,26 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 if ( RenderData.WedgeMap.Num() > 0 && ColorVertexBuffer.GetNumVertices() == RenderModel.GetNumVertices() )
                 {
                     // Use the wedge map if it is available as it is lossless.
-                    int32 NumWedges = RawMesh.WedgeIndices.Num();
-                    if ( RenderData.WedgeMap.Num() == NumWedges )
+                    if ( RenderData.WedgeMap.Num() == WedgeCount )
                     {
-                        int32 NumExistingColors = RawMesh.WedgeColors.Num();
-                        if ( NumExistingColors < NumWedges )
-                        {
-                            RawMesh.WedgeColors.AddUninitialized( NumWedges - NumExistingColors );
-                        }
-
                         // Replace mesh colors with override colors
-                        for ( int32 i = 0; i < NumWedges; ++i )
+                        for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; ++WedgeIdx )
                         {
+                            // The wedge map follows Unreal's winding order.
+                            const int32 CornerIdx = WedgeIdx % 3;
+                            const int32 Index = RenderData.WedgeMap[ WedgeIdx - CornerIdx + WedgeOrder[ CornerIdx ] ];
+
                             FColor WedgeColor = FColor::White;
-                            int32 Index = RenderData.WedgeMap[i];
                             if ( Index != INDEX_NONE )
                             {
                                 WedgeColor = ColorVertexBuffer.VertexColor( Index );
                             }
-                            RawMesh.WedgeColors[i] = WedgeColor;
+                            ChangedColors[ WedgeIdx ] = WedgeColor.ReinterpretAsLinear();
                         }
                     }
                 }
             }
 
-            // See if we have colors to upload.
-            if ( RawMesh.WedgeColors.Num() > 0 )
-            {
-                ChangedColors.SetNumUninitialized( RawMesh.WedgeColors.Num() );
-
-                if ( ImportAxis == HRSAI_Unreal )
-                {
-                    // We need to re-index colors for wedges we swapped (due to winding differences).
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                    {
-                        ChangedColors[WedgeIdx + 0] = RawMesh.WedgeColors[WedgeIdx + 0].ReinterpretAsLinear();
-                        ChangedColors[WedgeIdx + 1] = RawMesh.WedgeColors[WedgeIdx + 2].ReinterpretAsLinear();
-                        ChangedColors[WedgeIdx + 2] = RawMesh.WedgeColors[WedgeIdx + 1].ReinterpretAsLinear();
-                    }
-                }
-                else if ( ImportAxis == HRSAI_Houdini )
-                {
-                    for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
-                    {
-                        ChangedColors[WedgeIdx] = RawMesh.WedgeColors[WedgeIdx].ReinterpretAsLinear();
-                    }
-                }
-                else
-                {
-                    // Not valid enum value.
-                    check( 0 );
-                }
-            }
-
             if ( ChangedColors.Num() > 0 )
             {
                 // Extract the RGB colors
@@ -3322,29 +3706,15 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         }
 
         // Extract indices from static mesh.
-        if ( RawMesh.WedgeIndices.Num() > 0 )
+        if ( WedgeCount > 0 )
         {
+            // The wedges are already in Houdini's winding order.
             TArray< int32 > StaticMeshIndices;
-            StaticMeshIndices.SetNumUninitialized( RawMesh.WedgeIndices.Num() );
-
-            if ( ImportAxis == HRSAI_Unreal )
+            StaticMeshIndices.SetNumUninitialized( WedgeCount );
+            for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; ++WedgeIdx )
             {
-                for ( int32 IndexIdx = 0; IndexIdx < RawMesh.WedgeIndices.Num(); IndexIdx += 3 )
-                {
-                    // Swap indices to fix winding order.
-                    StaticMeshIndices[ IndexIdx + 0 ] = RawMesh.WedgeIndices[ IndexIdx + 0 ];
-                    StaticMeshIndices[ IndexIdx + 1 ] = RawMesh.WedgeIndices[ IndexIdx + 2 ];
-                    StaticMeshIndices[ IndexIdx + 2 ] = RawMesh.WedgeIndices[ IndexIdx + 1 ];
-                }
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
-            {
-                StaticMeshIndices = TArray< int32 >( RawMesh.WedgeIndices );
-            }
-            else
-            {
-                // Not valid enum value.
-                check( 0 );
+                const FVertexID VertexID = MeshDescription->GetVertexInstanceVertex( WedgeVertexInstanceIDs[ WedgeIdx ] );
+                StaticMeshIndices[ WedgeIdx ] = VertexPointIndices[ VertexID.GetValue() ];
             }
 
             // We can now set vertex list.
@@ -3361,8 +3731,33 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         }
 
         // Marshall face material indices.
-        if ( RawMesh.FaceMaterialIndices.Num() > 0 )
+        if ( FacePolygonIDs.Num() > 0 )
         {
+            // A polygon group's material is the slot of the same name, or the slot at its id.
+            TMap< FName, int32 > MaterialSlotIndices;
+            for ( int32 MaterialIdx = 0; MaterialIdx < StaticMesh->StaticMaterials.Num(); ++MaterialIdx )
+            {
+                const FName & SlotName = StaticMesh->StaticMaterials[ MaterialIdx ].ImportedMaterialSlotName;
+                if ( SlotName != NAME_None && !MaterialSlotIndices.Contains( SlotName ) )
+                    MaterialSlotIndices.Add( SlotName, MaterialIdx );
+            }
+
+            TMap< FPolygonGroupID, int32 > PolygonGroupMaterialIndices;
+            TArray< int32 > FaceMaterialIndices;
+            FaceMaterialIndices.SetNumUninitialized( FacePolygonIDs.Num() );
+            for ( int32 FaceIdx = 0; FaceIdx < FacePolygonIDs.Num(); ++FaceIdx )
+            {
+                const FPolygonGroupID PolygonGroupID = MeshDescription->GetPolygonPolygonGroup( FacePolygonIDs[ FaceIdx ] );
+                int32 * MaterialIndex = PolygonGroupMaterialIndices.Find( PolygonGroupID );
+                if ( !MaterialIndex )
+                {
+                    const int32 * SlotIndex = MaterialSlotIndices.Find( PolygonGroupMaterialSlotNames[ PolygonGroupID ] );
+                    MaterialIndex = &PolygonGroupMaterialIndices.Add( PolygonGroupID, SlotIndex ? *SlotIndex : PolygonGroupID.GetValue() );
+                }
+
+                FaceMaterialIndices[ FaceIdx ] = *MaterialIndex;
+            }
+
             // TODO: FIX ME PROPERLY
             // In some cases, deleted/unused materials could cause crashes in FHoudiniEngineUtils::CreateFaceMaterialArray() later
             // To avoid this, we need to make sure that the MaterialInterfaces array size matches the face material indexes..
@@ -3402,7 +3797,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                 }
 
                 // TODO: FIX ME PROPERLY
-                // Trying to fix up inconsistencies between the RawMesh / StaticMesh material indexes by using the meshes sections...
+                // Trying to fix up inconsistencies between the mesh description / StaticMesh material indexes by using the meshes sections...
                 int NumMeshBasedMtrls = StaticMeshComponent->GetNumMaterials();
                 TArray< UMaterialInterface * > MeshBasedMaterialInterfaces;
                 MeshBasedMaterialInterfaces.SetNumUninitialized(NumMeshBasedMtrls);
@@ -3428,7 +3823,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
                     MaterialInterfaces.Add( StaticMesh->GetMaterial(MatIdx) );
                 }
 
-                // Try to fix up inconsistencies between the RawMesh / StaticMesh material indexes
+                // Try to fix up inconsistencies between the mesh description / StaticMesh material indexes
                 // by using the meshes sections...
                 // TODO: Fix me properly!
                 // Proper fix would be to export the meshes via the FStaticMeshLODResources obtained
@@ -3469,7 +3864,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             // Create list of materials, one for each face.
             TArray< char * > StaticMeshFaceMaterials;
             FHoudiniEngineUtils::CreateFaceMaterialArray(
-                MaterialInterfaces, RawMesh.FaceMaterialIndices, StaticMeshFaceMaterials );
+                MaterialInterfaces, FaceMaterialIndices, StaticMeshFaceMaterials );
 
             // Get name of attribute used for marshalling materials.
             std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_MATERIAL;
@@ -3481,7 +3876,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             HAPI_AttributeInfo AttributeInfoMaterial;
             FHoudiniApi::AttributeInfo_Init(&AttributeInfoMaterial);
             //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoMaterial );
-            AttributeInfoMaterial.count = RawMesh.FaceMaterialIndices.Num();
+            AttributeInfoMaterial.count = FaceMaterialIndices.Num();
             AttributeInfoMaterial.tupleSize = 1;
             AttributeInfoMaterial.exists = true;
             AttributeInfoMaterial.owner = HAPI_ATTROWNER_PRIM;
@@ -3516,8 +3911,18 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
         }
 
         // Marshall face smoothing masks.
-        if ( RawMesh.FaceSmoothingMasks.Num() > 0 )
+        if ( FacePolygonIDs.Num() > 0 )
         {
+            // The masks are rebuilt from the hard edges, per polygon.
+            TArray< uint32 > PolygonSmoothingMasks;
+            PolygonSmoothingMasks.SetNumZeroed( MeshDescription->Polygons().GetArraySize() );
+            FMeshDescriptionOperations::ConvertHardEdgesToSmoothGroup( *MeshDescription, PolygonSmoothingMasks );
+
+            TArray< uint32 > FaceSmoothingMasks;
+            FaceSmoothingMasks.SetNumUninitialized( FacePolygonIDs.Num() );
+            for ( int32 FaceIdx = 0; FaceIdx < FacePolygonIDs.Num(); ++FaceIdx )
+                FaceSmoothingMasks[ FaceIdx ] = PolygonSmoothingMasks[ FacePolygonIDs[ FaceIdx ].GetValue() ];
+
             // Get name of attribute used for marshalling face smoothing masks.
             std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK;
             if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
@@ -3530,7 +3935,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             HAPI_AttributeInfo AttributeInfoSmoothingMasks;
             FHoudiniApi::AttributeInfo_Init(&AttributeInfoSmoothingMasks);
             //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoSmoothingMasks );
-            AttributeInfoSmoothingMasks.count = RawMesh.FaceSmoothingMasks.Num();
+            AttributeInfoSmoothingMasks.count = FaceSmoothingMasks.Num();
             AttributeInfoSmoothingMasks.tupleSize = 1;
             AttributeInfoSmoothingMasks.exists = true;
             AttributeInfoSmoothingMasks.owner = HAPI_ATTROWNER_PRIM;
@@ -3544,7 +3949,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForStaticMesh(
             HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
                 FHoudiniEngine::Get().GetSession(),
                 CurrentLODNodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfoSmoothingMasks,
-                (const int32 *) RawMesh.FaceSmoothingMasks.GetData(), 0, RawMesh.FaceSmoothingMasks.Num() ), false );
+                (const int32 *) FaceSmoothingMasks.GetData(), 0, FaceSmoothingMasks.Num() ), false );
         }
 
         // Marshall lightmap resolution.
@@ -4130,6 +4535,29 @@ FHoudiniEngineUtils::HapiCreateInputNodeForWorldOutliner(
         OutCreatedNodeIds.AddUnique( FHoudiniEngineUtils::HapiGetParentNodeId( ConnectedAssetId ) );
     }
 
+    // Sample the splines that changed since their last upload in parallel, the others keep their samples.
+    // Only the sampling runs in parallel, the input nodes are still created one after the other below.
+    const float fSplineResolution = GetMarshallingSplineResolution( SplineResolution );
+    const float fSplineMaxError = GetMarshallingSplineMaxError();
+
+    TArray< int32 > SplinesToSample;
+    for ( int32 InputIdx = 0; InputIdx < OutlinerMeshArray.Num(); ++InputIdx )
+    {
+        const auto & OutlinerMesh = OutlinerMeshArray[ InputIdx ];
+        if ( !OutlinerMesh.SplineComponent || OutlinerMesh.SplineComponent->IsPendingKill() )
+            continue;
+
+        if ( OutlinerMesh.SplineSamples.Positions.Num() <= 0
+            || OutlinerMesh.SplineSamples.Hash != GetSplineSamplingHash( OutlinerMesh.SplineComponent, fSplineResolution, fSplineMaxError ) )
+            SplinesToSample.Add( InputIdx );
+    }
+
+    ParallelFor( SplinesToSample.Num(), [ & ]( int32 SampleIdx )
+    {
+        auto & OutlinerMesh = OutlinerMeshArray[ SplinesToSample[ SampleIdx ] ];
+        SampleSpline( OutlinerMesh.SplineComponent, fSplineResolution, fSplineMaxError, OutlinerMesh.SplineSamples );
+    } );
+
     for ( int32 InputIdx = 0; InputIdx < OutlinerMeshArray.Num(); ++InputIdx )
     {
         auto & OutlinerMesh = OutlinerMeshArray[ InputIdx ];
@@ -4231,7 +4659,7 @@ FHoudiniEngineUtils::HapiCreateInputNodeForObjects(
         else if ( InputSkeletalMesh && !InputSkeletalMesh->IsPendingKill() )
         {
             // Creating an Input Node for Skeletal Mesh Data
-            if ( !HapiCreateInputNodeForSkeletalMesh( ConnectedAssetId, InputSkeletalMesh, MeshAssetNodeId, OutCreatedNodeIds, bExportSkeleton ) )
+            if ( !HapiCreateInputNodeForSkeletalMesh( ConnectedAssetId, InputSkeletalMesh, MeshAssetNodeId, OutCreatedNodeIds, bExportSkeleton, bExportAllLODs ) )
             {
                 HOUDINI_LOG_WARNING( TEXT( "Error creating input index %d on %d" ), InputIdx, ConnectedAssetId );
             }
@@ -4275,11 +4703,165 @@ FHoudiniEngineUtils::HapiCreateInputNodeForObjects(
     return true;
 }
 
+bool
+FHoudiniEngineUtils::ExtractSkeletalMeshLODData(
+    const FSkeletalMeshLODModel & LODModel,
+    const float & GeometryScaleFactor, const bool & bSwapYZ,
+    FHoudiniSkeletalMeshLODData & OutLODData )
+{
+#if WITH_EDITOR
+    // Disabled sections are the originals of legacy clothing sections, their duplicate is exported instead.
+    // Lay out the points and faces of the remaining sections first, so they can be filled in parallel.
+    TArray< int32 > SectionIndices;
+    TArray< int32 > SectionPointOffsets;
+    TArray< int32 > SectionFaceOffsets;
+    int32 PointCount = 0;
+    int32 FaceCount = 0;
+    for ( int32 SectionIndex = 0; SectionIndex < LODModel.Sections.Num(); ++SectionIndex )
+    {
+        const FSkelMeshSection & Section = LODModel.Sections[ SectionIndex ];
+        if ( Section.bDisabled || Section.SoftVertices.Num() <= 0 )
+            continue;
+
+        if ( (int64)Section.BaseIndex + (int64)Section.NumTriangles * 3 > (int64)LODModel.IndexBuffer.Num() )
+            return false;
+
+        SectionIndices.Add( SectionIndex );
+        SectionPointOffsets.Add( PointCount );
+        SectionFaceOffsets.Add( FaceCount );
+        PointCount += Section.SoftVertices.Num();
+        FaceCount += Section.NumTriangles;
+    }
+
+    if ( PointCount <= 0 || FaceCount <= 0 )
+        return false;
+
+    // Widest vertex influence, zero weights are dropped rather than padded to MAX_TOTAL_INFLUENCES.
+    TArray< int32 > SectionInfluenceCounts;
+    SectionInfluenceCounts.SetNumZeroed( SectionIndices.Num() );
+    ParallelFor( SectionIndices.Num(), [&]( int32 Idx )
+    {
+        int32 MaxInfluences = 0;
+        for ( const FSoftSkinVertex & SoftVertex : LODModel.Sections[ SectionIndices[ Idx ] ].SoftVertices )
+        {
+            int32 Influences = 0;
+            for ( int32 InfluenceIdx = 0; InfluenceIdx < MAX_TOTAL_INFLUENCES; ++InfluenceIdx )
+                Influences += SoftVertex.InfluenceWeights[ InfluenceIdx ] > 0 ? 1 : 0;
+
+            MaxInfluences = FMath::Max( MaxInfluences, Influences );
+        }
+        SectionInfluenceCounts[ Idx ] = MaxInfluences;
+    } );
+
+    int32 InfluenceCount = 0;
+    for ( int32 SectionInfluenceCount : SectionInfluenceCounts )
+        InfluenceCount = FMath::Max( InfluenceCount, SectionInfluenceCount );
+
+    const int32 NumTexCoords = FMath::Clamp< int32 >( LODModel.NumTexCoords, 0, MAX_TEXCOORDS );
+    const int32 VertexCount = FaceCount * 3;
+
+    OutLODData.Positions.SetNumUninitialized( PointCount * 3 );
+    OutLODData.VertexList.SetNumUninitialized( VertexCount );
+    OutLODData.Normals.SetNumUninitialized( VertexCount * 3 );
+    OutLODData.Colors.SetNumUninitialized( VertexCount * 4 );
+    OutLODData.FaceMaterialIds.SetNumUninitialized( FaceCount );
+    OutLODData.UVs.SetNum( NumTexCoords );
+    for ( TArray< float > & UVs : OutLODData.UVs )
+        UVs.SetNumUninitialized( VertexCount * 3 );
+
+    OutLODData.InfluenceCount = InfluenceCount;
+    OutLODData.BoneIndices.Init( -1, PointCount * InfluenceCount );
+    OutLODData.BoneWeights.Init( 0.0f, PointCount * InfluenceCount );
+
+    // Unreal's winding order is the reverse of Houdini's.
+    static const int32 UnrealWinding[ 3 ] = { 0, 1, 2 };
+    static const int32 HoudiniWinding[ 3 ] = { 0, 2, 1 };
+    const int32 * WedgeOrder = bSwapYZ ? HoudiniWinding : UnrealWinding;
+    const int32 YAxis = bSwapYZ ? 2 : 1;
+    const int32 ZAxis = bSwapYZ ? 1 : 2;
+
+    ParallelFor( SectionIndices.Num(), [&]( int32 Idx )
+    {
+        const FSkelMeshSection & Section = LODModel.Sections[ SectionIndices[ Idx ] ];
+        const TArray< FSoftSkinVertex > & SoftVertices = Section.SoftVertices;
+        const int32 PointOffset = SectionPointOffsets[ Idx ];
+
+        for ( int32 LocalIdx = 0; LocalIdx < SoftVertices.Num(); ++LocalIdx )
+        {
+            const FSoftSkinVertex & SoftVertex = SoftVertices[ LocalIdx ];
+            const int32 PointIdx = PointOffset + LocalIdx;
+
+            float * Position = &OutLODData.Positions[ PointIdx * 3 ];
+            Position[ 0 ] = SoftVertex.Position.X / GeometryScaleFactor;
+            Position[ YAxis ] = SoftVertex.Position.Y / GeometryScaleFactor;
+            Position[ ZAxis ] = SoftVertex.Position.Z / GeometryScaleFactor;
+
+            int32 PackedIdx = PointIdx * InfluenceCount;
+            for ( int32 InfluenceIdx = 0; InfluenceIdx < MAX_TOTAL_INFLUENCES; ++InfluenceIdx )
+            {
+                const uint8 Weight = SoftVertex.InfluenceWeights[ InfluenceIdx ];
+                const int32 SectionBoneIdx = SoftVertex.InfluenceBones[ InfluenceIdx ];
+                if ( Weight == 0 || !Section.BoneMap.IsValidIndex( SectionBoneIdx ) )
+                    continue;
+
+                OutLODData.BoneIndices[ PackedIdx ] = Section.BoneMap[ SectionBoneIdx ];
+                OutLODData.BoneWeights[ PackedIdx ] = (float)Weight / 255.0f;
+                PackedIdx++;
+            }
+        }
+
+        // Faces index the LOD's vertex buffer, the section's vertices start at BaseVertexIndex.
+        const int32 FaceOffset = SectionFaceOffsets[ Idx ];
+        for ( uint32 TriangleIdx = 0; TriangleIdx < Section.NumTriangles; ++TriangleIdx )
+        {
+            const int32 FaceIdx = FaceOffset + TriangleIdx;
+            OutLODData.FaceMaterialIds[ FaceIdx ] = Section.MaterialIndex;
+
+            for ( int32 Corner = 0; Corner < 3; ++Corner )
+            {
+                const int32 WedgeIdx = FaceIdx * 3 + Corner;
+                const int32 LocalIdx = FMath::Clamp< int32 >(
+                    (int32)LODModel.IndexBuffer[ Section.BaseIndex + TriangleIdx * 3 + WedgeOrder[ Corner ] ] - (int32)Section.BaseVertexIndex,
+                    0, SoftVertices.Num() - 1 );
+                const FSoftSkinVertex & SoftVertex = SoftVertices[ LocalIdx ];
+
+                OutLODData.VertexList[ WedgeIdx ] = PointOffset + LocalIdx;
+
+                const FVector Normal( SoftVertex.TangentZ );
+                float * OutNormal = &OutLODData.Normals[ WedgeIdx * 3 ];
+                OutNormal[ 0 ] = Normal.X;
+                OutNormal[ YAxis ] = Normal.Y;
+                OutNormal[ ZAxis ] = Normal.Z;
+
+                const FLinearColor Color = SoftVertex.Color.ReinterpretAsLinear();
+                float * OutColor = &OutLODData.Colors[ WedgeIdx * 4 ];
+                OutColor[ 0 ] = Color.R;
+                OutColor[ 1 ] = Color.G;
+                OutColor[ 2 ] = Color.B;
+                OutColor[ 3 ] = Color.A;
+
+                for ( int32 TexCoordIdx = 0; TexCoordIdx < NumTexCoords; ++TexCoordIdx )
+                {
+                    float * OutUV = &OutLODData.UVs[ TexCoordIdx ][ WedgeIdx * 3 ];
+                    OutUV[ 0 ] = SoftVertex.UVs[ TexCoordIdx ].X;
+                    OutUV[ 1 ] = 1.0f - SoftVertex.UVs[ TexCoordIdx ].Y;
+                    OutUV[ 2 ] = 0.0f;
+                }
+            }
+        }
+    } );
+
+    return true;
+#else
+    return false;
+#endif
+}
+
 bool
 FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
     HAPI_NodeId HostAssetId, USkeletalMesh * SkeletalMesh,
     HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds,
-    const bool& bExportSkeleton )
+    const bool& bExportSkeleton, const bool& bExportAllLODs /* = false */ )
 {
 #if WITH_EDITOR
     // If we don't have a skeletal mesh there's nothing to do.
@@ -4323,41 +4905,65 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
         GeneratedLightMapResolution = HoudiniRuntimeSettings->LightMapResolution;
     }
 
-    // Grab base LOD level.
+    // Grab the LOD levels.
     const FSkeletalMeshModel* SkelMeshResource = SkeletalMesh->GetImportedModel();
-    if ( !SkelMeshResource )
+    if ( !SkelMeshResource || SkelMeshResource->LODModels.Num() <= 0 )
         return false;
 
-    const FSkeletalMeshLODModel& SourceModel = SkelMeshResource->LODModels[0];
-    const int32 VertexCount = SourceModel.GetNumNonClothingVertices();
+    const int32 NumLODsToExport = bExportAllLODs ? SkelMeshResource->LODModels.Num() : 1;
+    const bool bDoExportLODs = NumLODsToExport > 1;
 
-    // Verify the integrity of the mesh.
-    if ( VertexCount <= 0 ) 
-        return false;
+    // Flatten all the LODs in parallel, reading the sections' soft skin vertices in place.
+    TArray< FHoudiniSkeletalMeshLODData > LODDatas;
+    LODDatas.SetNum( NumLODsToExport );
+    TArray< bool > LODExtracted;
+    LODExtracted.SetNumZeroed( NumLODsToExport );
+    ParallelFor( NumLODsToExport, [&]( int32 LODIndex )
+    {
+        LODExtracted[ LODIndex ] = FHoudiniEngineUtils::ExtractSkeletalMeshLODData(
+            SkelMeshResource->LODModels[ LODIndex ], GeneratedGeometryScaleFactor,
+            ImportAxis == HRSAI_Unreal, LODDatas[ LODIndex ] );
+    } );
 
-    // Extract the vertices buffer (this also contains normals, uvs, colors...)
-    TArray<FSoftSkinVertex> SoftSkinVertices;
-    SourceModel.GetNonClothVertices( SoftSkinVertices );
-    if ( SoftSkinVertices.Num() != VertexCount )
+    // The base LOD is required, others are skipped if they are empty.
+    if ( !LODExtracted[ 0 ] )
         return false;
 
-    // Extract the indices
-    TArray<uint32> Indices = SourceModel.IndexBuffer;
-    int32 FaceCount = Indices.Num() / 3;
+    // All LODs share one part, each LOD's points and faces follow the previous one's.
+    TArray< int32 > LODPointOffsets;
+    TArray< int32 > LODFaceOffsets;
+    LODPointOffsets.SetNumZeroed( NumLODsToExport );
+    LODFaceOffsets.SetNumZeroed( NumLODsToExport );
+    int32 PointCount = 0;
+    int32 FaceCount = 0;
+    int32 NumTexCoords = 0;
+    int32 InfluenceCount = 0;
+    for ( int32 LODIndex = 0; LODIndex < NumLODsToExport; ++LODIndex )
+    {
+        LODPointOffsets[ LODIndex ] = PointCount;
+        LODFaceOffsets[ LODIndex ] = FaceCount;
+        if ( !LODExtracted[ LODIndex ] )
+            continue;
+
+        const FHoudiniSkeletalMeshLODData & LODData = LODDatas[ LODIndex ];
+        PointCount += LODData.GetPointCount();
+        FaceCount += LODData.GetFaceCount();
+        NumTexCoords = FMath::Max( NumTexCoords, LODData.UVs.Num() );
+        InfluenceCount = FMath::Max( InfluenceCount, LODData.InfluenceCount );
+    }
 
     // Create part.
     HAPI_PartInfo Part;
     FHoudiniApi::PartInfo_Init(&Part);
-    //FMemory::Memzero< HAPI_PartInfo >(Part);
     Part.id = 0;
     Part.nameSH = 0;
     Part.attributeCounts[ HAPI_ATTROWNER_POINT ] = 0;
     Part.attributeCounts[ HAPI_ATTROWNER_PRIM ] = 0;
     Part.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 0;
     Part.attributeCounts[ HAPI_ATTROWNER_DETAIL ] = 0;
-    Part.vertexCount = Indices.Num();
+    Part.vertexCount = FaceCount * 3;
     Part.faceCount = FaceCount;
-    Part.pointCount = SoftSkinVertices.Num();
+    Part.pointCount = PointCount;
     Part.type = HAPI_PARTTYPE_MESH;
 
     HAPI_GeoInfo DisplayGeoInfo;
@@ -4368,308 +4974,207 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
     HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
         FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0, &Part ), false );
 
-
-    //-------------------------------------------------------------------------
-    // POSITIONS
-    //-------------------------------------------------------------------------
-    
-    // Create point attribute info.
-    HAPI_AttributeInfo AttributeInfoPoint;
-    FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
-    //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPoint );
-    AttributeInfoPoint.count = SoftSkinVertices.Num();
-    AttributeInfoPoint.tupleSize = 3;
-    AttributeInfoPoint.exists = true;
-    AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
-    AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
-    AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
-
-    HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
-        HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint ), false );
-
-    // Convert vertices from the skeletal mesh to a float array
-    TArray< float > SkelMeshVertices;
-    SkelMeshVertices.SetNumZeroed( SoftSkinVertices.Num() * 3 );
-    for ( int32 VertexIdx = 0; VertexIdx < SoftSkinVertices.Num(); ++VertexIdx )
+    // Attributes are created once for the whole part, then every LOD uploads its own range.
+    auto AddAttribute = [&]( const char * AttributeName, HAPI_AttributeOwner Owner, HAPI_StorageType Storage, int32 TupleSize, HAPI_AttributeInfo & AttributeInfo )
     {
-        // Grab vertex at this index.
-        const FVector & PositionVector = SoftSkinVertices[ VertexIdx ].Position;
-        if ( ImportAxis == HRSAI_Unreal )
-        {
-            SkelMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
-            SkelMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
-            SkelMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
-        }
-        else
-        {
-            SkelMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
-            SkelMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
-            SkelMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
-        }
-    }
+        FHoudiniApi::AttributeInfo_Init( &AttributeInfo );
+        AttributeInfo.count = Owner == HAPI_ATTROWNER_POINT ? PointCount : Owner == HAPI_ATTROWNER_PRIM ? FaceCount : FaceCount * 3;
+        AttributeInfo.tupleSize = TupleSize;
+        AttributeInfo.exists = true;
+        AttributeInfo.owner = Owner;
+        AttributeInfo.storage = Storage;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
-    // Now that we have raw positions, we can upload them for our attribute.
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-        0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
-        SkelMeshVertices.GetData(), 0,
-        AttributeInfoPoint.count ), false );
+        return FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0, AttributeName, &AttributeInfo ) == HAPI_RESULT_SUCCESS;
+    };
 
+    HAPI_AttributeInfo AttributeInfoPoint;
+    HAPI_AttributeInfo AttributeInfoNormals;
+    HAPI_AttributeInfo AttributeInfoColors;
+    if ( !AddAttribute( HAPI_UNREAL_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, HAPI_STORAGETYPE_FLOAT, 3, AttributeInfoPoint )
+        || !AddAttribute( HAPI_UNREAL_ATTRIB_NORMAL, HAPI_ATTROWNER_VERTEX, HAPI_STORAGETYPE_FLOAT, 3, AttributeInfoNormals )
+        || !AddAttribute( HAPI_UNREAL_ATTRIB_COLOR, HAPI_ATTROWNER_VERTEX, HAPI_STORAGETYPE_FLOAT, 4, AttributeInfoColors ) )
+        return false;
 
-    //-------------------------------------------------------------------------
-    // UVS
-    //-------------------------------------------------------------------------
-    // See if we have texture coordinates to upload.
-    for ( uint32 MeshTexCoordIdx = 0; MeshTexCoordIdx < SourceModel.NumTexCoords; ++MeshTexCoordIdx )
+    TArray< std::string > UVAttributeNames;
+    TArray< HAPI_AttributeInfo > AttributeInfoUVs;
+    UVAttributeNames.SetNum( NumTexCoords );
+    AttributeInfoUVs.SetNum( NumTexCoords );
+    for ( int32 TexCoordIdx = 0; TexCoordIdx < NumTexCoords; ++TexCoordIdx )
     {
-        TArray< FVector > MeshUVs;
-        MeshUVs.SetNumUninitialized( Indices.Num() );
-
-        // Transfer UV data.
-        for ( int32 UVIdx = 0; UVIdx < Indices.Num(); ++UVIdx )
-        {
-            // Grab uv for this coordSet at this index.
-            const FVector2D & UV = SoftSkinVertices[ Indices[UVIdx] ].UVs[ MeshTexCoordIdx ];
-            MeshUVs[ UVIdx ] = FVector(UV.X, 1.0 - UV.Y, 0);
-        }
-
-        if ( ImportAxis == HRSAI_Unreal )
-        {
-            // We need to re-index UVs due to swapped indices in the faces (due to winding order differences) 
-            for ( int32 WedgeIdx = 0; WedgeIdx < Indices.Num(); WedgeIdx += 3 )
-            {
-                // Swap second and third values for the vertices of the face
-                MeshUVs.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-            }
-        }
-
         // Construct attribute name for this index.
         FString UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
-        if ( MeshTexCoordIdx > 0 )
-            UVAttributeName += FString::Printf(TEXT("%d"), MeshTexCoordIdx + 1);
-
-        // Create attribute for UVs
-        HAPI_AttributeInfo AttributeInfoUVS;
-        FHoudiniApi::AttributeInfo_Init(&AttributeInfoUVS);
-        //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoUVS );
-        AttributeInfoUVS.count = MeshUVs.Num();
-        AttributeInfoUVS.tupleSize = 3;
-        AttributeInfoUVS.exists = true;
-        AttributeInfoUVS.owner = HAPI_ATTROWNER_VERTEX;
-        AttributeInfoUVS.storage = HAPI_STORAGETYPE_FLOAT;
-        AttributeInfoUVS.originalOwner = HAPI_ATTROWNER_INVALID;
-
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, TCHAR_TO_ANSI( *UVAttributeName ), &AttributeInfoUVS), false );
+        if ( TexCoordIdx > 0 )
+            UVAttributeName += FString::Printf( TEXT( "%d" ), TexCoordIdx + 1 );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, TCHAR_TO_ANSI( *UVAttributeName ), &AttributeInfoUVS,
-            (const float *) MeshUVs.GetData(), 0, AttributeInfoUVS.count ), false );
+        UVAttributeNames[ TexCoordIdx ] = TCHAR_TO_ANSI( *UVAttributeName );
+        if ( !AddAttribute( UVAttributeNames[ TexCoordIdx ].c_str(), HAPI_ATTROWNER_VERTEX, HAPI_STORAGETYPE_FLOAT, 3, AttributeInfoUVs[ TexCoordIdx ] ) )
+            return false;
     }
-    
-
-    //-------------------------------------------------------------------------
-    // NORMALS
-    //-------------------------------------------------------------------------
-    TArray< FVector > MeshNormals;
-    MeshNormals.SetNumUninitialized( Indices.Num() );
 
-    // Transfer Normal data.
-    for (int32 NormalIdx = 0; NormalIdx < Indices.Num(); ++NormalIdx)
+    // Skin weights, packed to the widest influence count of all the LODs.
+    HAPI_AttributeInfo AttributeInfoBoneIndices;
+    HAPI_AttributeInfo AttributeInfoBoneWeights;
+    if ( InfluenceCount > 0 )
     {
-        FPackedNormal PackedNormal = SoftSkinVertices[Indices[NormalIdx]].TangentZ;
-        MeshNormals[NormalIdx] = PackedNormal.ToFVector();
-
-        // Doesnt work on MacOS ...
-        //MeshNormals[ NormalIdx ] = FVector( SoftSkinVertices[ Indices[NormalIdx]  ].TangentZ.Vector. );
+        if ( !AddAttribute( HAPI_UNREAL_ATTRIB_SKIN_BONE_INDICES, HAPI_ATTROWNER_POINT, HAPI_STORAGETYPE_INT, InfluenceCount, AttributeInfoBoneIndices )
+            || !AddAttribute( HAPI_UNREAL_ATTRIB_SKIN_BONE_WEIGHTS, HAPI_ATTROWNER_POINT, HAPI_STORAGETYPE_FLOAT, InfluenceCount, AttributeInfoBoneWeights ) )
+            return false;
     }
 
-    if ( ImportAxis == HRSAI_Unreal )
-    {
-        // We need to re-index normals due to swapped indices on the faces (due to winding differences).
-        for ( int32 WedgeIdx = 0; WedgeIdx < Indices.Num(); WedgeIdx += 3 )
-        {
-            // Swap second and third values for the vertices of the face
-            MeshNormals.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-        }
+    // Get name of attribute used for marshalling materials.
+    std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_MATERIAL;
+    if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
+        FHoudiniEngineUtils::ConvertUnrealString( HoudiniRuntimeSettings->MarshallingAttributeMaterial, MarshallingAttributeName );
 
-        // Also swap the normal's Y and Z
-        for ( int32 WedgeIdx = 0; WedgeIdx < Indices.Num(); ++WedgeIdx )
-            Swap( MeshNormals[ WedgeIdx ].Y, MeshNormals[ WedgeIdx ].Z );
-    }
+    HAPI_AttributeInfo AttributeInfoMaterial;
+    if ( !AddAttribute( MarshallingAttributeName.c_str(), HAPI_ATTROWNER_PRIM, HAPI_STORAGETYPE_STRING, 1, AttributeInfoMaterial ) )
+        return false;
 
-    // Create attribute for normals.
-    HAPI_AttributeInfo AttributeInfoNormals;
-    FHoudiniApi::AttributeInfo_Init(&AttributeInfoNormals);
-    //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoNormals );
-    AttributeInfoNormals.count = MeshNormals.Num();
-    AttributeInfoNormals.tupleSize = 3;
-    AttributeInfoNormals.exists = true;
-    AttributeInfoNormals.owner = HAPI_ATTROWNER_VERTEX;
-    AttributeInfoNormals.storage = HAPI_STORAGETYPE_FLOAT;
-    AttributeInfoNormals.originalOwner = HAPI_ATTROWNER_INVALID;
+    // Create an array of Material Interfaces
+    TArray< UMaterialInterface * > MaterialInterfaces;
+    MaterialInterfaces.SetNum( SkeletalMesh->Materials.Num() );
+    for( int32 MatIdx = 0; MatIdx < SkeletalMesh->Materials.Num(); MatIdx++ )
+        MaterialInterfaces[MatIdx] = SkeletalMesh->Materials[ MatIdx ].MaterialInterface;
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+    // Face counts are the same for every LOD.
+    TArray< int32 > MeshFaceCounts;
+    MeshFaceCounts.Init( 3, FaceCount );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
         FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-        0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoNormals ), false );
+        0, MeshFaceCounts.GetData(), 0, MeshFaceCounts.Num() ), false );
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-        FHoudiniEngine::Get().GetSession(),
-        DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoNormals,
-        (const float *)MeshNormals.GetData(),
-        0, AttributeInfoNormals.count ), false );
+    for ( int32 LODIndex = 0; LODIndex < NumLODsToExport; ++LODIndex )
+    {
+        if ( !LODExtracted[ LODIndex ] )
+            continue;
 
+        FHoudiniSkeletalMeshLODData & LODData = LODDatas[ LODIndex ];
+        const int32 LODPointCount = LODData.GetPointCount();
+        const int32 LODFaceCount = LODData.GetFaceCount();
+        const int32 PointOffset = LODPointOffsets[ LODIndex ];
+        const int32 FaceOffset = LODFaceOffsets[ LODIndex ];
 
-    //-------------------------------------------------------------------------
-    // Vertex Colors
-    //-------------------------------------------------------------------------
-    TArray< FLinearColor > MeshColors;
-    MeshColors.SetNumUninitialized( Indices.Num() );
+        //-------------------------------------------------------------------------
+        // POSITIONS AND INDICES
+        //-------------------------------------------------------------------------
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+            0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+            LODData.Positions.GetData(), PointOffset, LODPointCount ), false );
 
-    // Transfer Color data.
-    for (int32 ColorIdx = 0; ColorIdx < Indices.Num(); ++ColorIdx)
-    {
-        MeshColors[ ColorIdx ] = SoftSkinVertices[ Indices[ColorIdx] ].Color.ReinterpretAsLinear();
-    }
-    
-    if ( ImportAxis == HRSAI_Unreal )
-    {
-        // We need to re-index colors due to swapped indices on the faces (due to winding differences).
-        for ( int32 WedgeIdx = 0; WedgeIdx < Indices.Num(); WedgeIdx += 3 )
+        if ( PointOffset > 0 )
         {
-            // Swap second and third values for the vertices of the face
-            MeshColors.SwapMemory(WedgeIdx + 1, WedgeIdx + 2);
+            for ( int32 & PointIdx : LODData.VertexList )
+                PointIdx += PointOffset;
         }
-    }
 
-    // Create attribute for colors.
-    HAPI_AttributeInfo AttributeInfoColors;
-    FHoudiniApi::AttributeInfo_Init(&AttributeInfoColors);
-    //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoColors );
-    AttributeInfoColors.count = MeshColors.Num();
-    AttributeInfoColors.tupleSize = 4;
-    AttributeInfoColors.exists = true;
-    AttributeInfoColors.owner = HAPI_ATTROWNER_VERTEX;
-    AttributeInfoColors.storage = HAPI_STORAGETYPE_FLOAT;
-    AttributeInfoColors.originalOwner = HAPI_ATTROWNER_INVALID;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+            0, LODData.VertexList.GetData(), FaceOffset * 3, LODData.VertexList.Num() ), false );
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-        0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoColors), false );
+        //-------------------------------------------------------------------------
+        // UVS, NORMALS AND COLORS
+        //-------------------------------------------------------------------------
+        // LODs with fewer texture coordinates leave the extra UV sets at zero.
+        for ( int32 TexCoordIdx = 0; TexCoordIdx < LODData.UVs.Num(); ++TexCoordIdx )
+        {
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+                0, UVAttributeNames[ TexCoordIdx ].c_str(), &AttributeInfoUVs[ TexCoordIdx ],
+                LODData.UVs[ TexCoordIdx ].GetData(), FaceOffset * 3, LODFaceCount * 3 ), false );
+        }
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-        FHoudiniEngine::Get().GetSession(),
-        DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoColors,
-        (const float *)MeshColors.GetData(), 0, AttributeInfoColors.count ), false );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+            0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoNormals,
+            LODData.Normals.GetData(), FaceOffset * 3, LODFaceCount * 3 ), false );
 
-    //-------------------------------------------------------------------------
-    // Indices
-    //-------------------------------------------------------------------------
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+            0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoColors,
+            LODData.Colors.GetData(), FaceOffset * 3, LODFaceCount * 3 ), false );
+
+        //-------------------------------------------------------------------------
+        // SKIN WEIGHTS
+        //-------------------------------------------------------------------------
+        if ( InfluenceCount > 0 )
+        {
+            // Widen this LOD's tuples if another LOD has more influences per vertex.
+            if ( LODData.InfluenceCount < InfluenceCount )
+            {
+                TArray< int32 > BoneIndices;
+                TArray< float > BoneWeights;
+                BoneIndices.Init( -1, LODPointCount * InfluenceCount );
+                BoneWeights.Init( 0.0f, LODPointCount * InfluenceCount );
+                for ( int32 PointIdx = 0; PointIdx < LODPointCount; ++PointIdx )
+                {
+                    for ( int32 InfluenceIdx = 0; InfluenceIdx < LODData.InfluenceCount; ++InfluenceIdx )
+                    {
+                        BoneIndices[ PointIdx * InfluenceCount + InfluenceIdx ] = LODData.BoneIndices[ PointIdx * LODData.InfluenceCount + InfluenceIdx ];
+                        BoneWeights[ PointIdx * InfluenceCount + InfluenceIdx ] = LODData.BoneWeights[ PointIdx * LODData.InfluenceCount + InfluenceIdx ];
+                    }
+                }
 
-    // Extract indices from static mesh.
-    TArray< int32 > MeshIndices;
-    MeshIndices.SetNumUninitialized( Indices.Num() );
+                LODData.BoneIndices = MoveTemp( BoneIndices );
+                LODData.BoneWeights = MoveTemp( BoneWeights );
+                LODData.InfluenceCount = InfluenceCount;
+            }
 
-    if ( ImportAxis == HRSAI_Unreal )
-    {
-        // We have to swap indices to fix the winding order.
-        for ( int32 IndexIdx = 0; IndexIdx < Indices.Num(); IndexIdx += 3 )
-        {            
-            MeshIndices[ IndexIdx + 0 ] = Indices[ IndexIdx + 0 ];
-            MeshIndices[ IndexIdx + 1 ] = Indices[ IndexIdx + 2 ];
-            MeshIndices[ IndexIdx + 2 ] = Indices[ IndexIdx + 1 ];
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
+                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+                0, HAPI_UNREAL_ATTRIB_SKIN_BONE_INDICES, &AttributeInfoBoneIndices,
+                LODData.BoneIndices.GetData(), PointOffset, LODPointCount ), false );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+                0, HAPI_UNREAL_ATTRIB_SKIN_BONE_WEIGHTS, &AttributeInfoBoneWeights,
+                LODData.BoneWeights.GetData(), PointOffset, LODPointCount ), false );
         }
-    }
-    else
-    {
-        // Direct copy, no need to change the winding order
-        MeshIndices = TArray< int32 >( Indices );
-    }
 
-    // We can now set the vertex list.
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-        0, MeshIndices.GetData(), 0, MeshIndices.Num() ), false );
+        //-------------------------------------------------------------------------
+        // Face Materials
+        //-------------------------------------------------------------------------
+        // Create list of materials, one for each face.
+        TArray< char * > MeshFaceMaterials;
+        FHoudiniEngineUtils::CreateFaceMaterialArray(
+            MaterialInterfaces, LODData.FaceMaterialIds, MeshFaceMaterials );
 
-    // We need to generate the array of face counts.
-    TArray< int32 > MeshFaceCounts;
-    MeshFaceCounts.Init( 3, Part.faceCount );
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-        0, MeshFaceCounts.GetData(), 0, MeshFaceCounts.Num() ), false );
+        HAPI_Result MaterialResult = FHoudiniApi::SetAttributeStringData(
+            FHoudiniEngine::Get().GetSession(),
+            DisplayGeoInfo.nodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfoMaterial,
+            (const char **) MeshFaceMaterials.GetData(), FaceOffset, MeshFaceMaterials.Num() );
 
-    //-------------------------------------------------------------------------
-    // Face Materials
-    //-------------------------------------------------------------------------
-    TArray<int32> FaceMaterialIds;
-    FaceMaterialIds.SetNumUninitialized( FaceCount );
-    int32 FaceIdx = 0;
-    int32 SectionCount = SourceModel.NumNonClothingSections();
-    for (int32 SectionIndex = 0; SectionIndex < SectionCount; ++SectionIndex)
-    {
-        const FSkelMeshSection& Section = SourceModel.Sections[SectionIndex];
+        // Delete material names.
+        FHoudiniEngineUtils::DeleteFaceMaterialArray( MeshFaceMaterials );
 
-        // Copy the material sections for all the faces of the current section
-        int32 CurrentMatIndex = Section.MaterialIndex;
-        for (int32 TriangleIndex = 0; TriangleIndex < (int32)Section.NumTriangles; ++TriangleIndex)
+        if ( MaterialResult != HAPI_RESULT_SUCCESS )
         {
-            FaceMaterialIds[FaceIdx++] = CurrentMatIndex;
+            check( 0 );
+            return false;
         }
-    }
-
-    // Create an array of Material Interfaces
-    TArray< UMaterialInterface * > MaterialInterfaces;
-    MaterialInterfaces.SetNum( SkeletalMesh->Materials.Num() );
-    for( int32 MatIdx = 0; MatIdx < SkeletalMesh->Materials.Num(); MatIdx++ )
-        MaterialInterfaces[MatIdx] = SkeletalMesh->Materials[ MatIdx ].MaterialInterface;
-
-    // Create list of materials, one for each face.
-    TArray< char * > MeshFaceMaterials;
-    FHoudiniEngineUtils::CreateFaceMaterialArray(
-        MaterialInterfaces, FaceMaterialIds, MeshFaceMaterials );
-
-    // Get name of attribute used for marshalling materials.
-    std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_MATERIAL;
-    if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
-        FHoudiniEngineUtils::ConvertUnrealString( HoudiniRuntimeSettings->MarshallingAttributeMaterial, MarshallingAttributeName );
 
-    // Create attribute for materials.
-    HAPI_AttributeInfo AttributeInfoMaterial;
-    FHoudiniApi::AttributeInfo_Init(&AttributeInfoMaterial);
-    //FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoMaterial );
-    AttributeInfoMaterial.count = FaceMaterialIds.Num();
-    AttributeInfoMaterial.tupleSize = 1;
-    AttributeInfoMaterial.exists = true;
-    AttributeInfoMaterial.owner = HAPI_ATTROWNER_PRIM;
-    AttributeInfoMaterial.storage = HAPI_STORAGETYPE_STRING;
-    AttributeInfoMaterial.originalOwner = HAPI_ATTROWNER_INVALID;
-
-    bool bAttributeError = false;
-    if ( FHoudiniApi::AddAttribute( FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
-        MarshallingAttributeName.c_str(), &AttributeInfoMaterial ) != HAPI_RESULT_SUCCESS )
-    {
-        bAttributeError = true;
-    }
-
-    if ( FHoudiniApi::SetAttributeStringData(
-        FHoudiniEngine::Get().GetSession(),
-        DisplayGeoInfo.nodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfoMaterial,
-        (const char **) MeshFaceMaterials.GetData(), 0,
-        MeshFaceMaterials.Num() ) != HAPI_RESULT_SUCCESS )
-    {
-        bAttributeError = true;
-    }
+        //-------------------------------------------------------------------------
+        // LOD Group
+        //-------------------------------------------------------------------------
+        if ( bDoExportLODs )
+        {
+            std::string LODGroupStr = TCHAR_TO_UTF8( *( TEXT( "lod" ) + FString::FromInt( LODIndex ) ) );
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddGroup(
+                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+                HAPI_GROUPTYPE_PRIM, LODGroupStr.c_str() ), false );
 
-    // Delete material names.
-    FHoudiniEngineUtils::DeleteFaceMaterialArray( MeshFaceMaterials );
+            // Faces of the other LODs are left out of the group.
+            TArray< int32 > GroupArray;
+            GroupArray.Init( 1, LODFaceCount );
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetGroupMembership(
+                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+                HAPI_GROUPTYPE_PRIM, LODGroupStr.c_str(), GroupArray.GetData(), FaceOffset, LODFaceCount ), false );
+        }
 
-    if ( bAttributeError )
-    {
-        check( 0 );
-        return false;
+        // The LOD's data has been uploaded, release it.
+        LODData = FHoudiniSkeletalMeshLODData();
     }
 
     //-------------------------------------------------------------------------
@@ -4764,15 +5269,56 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
         }
     }
 
-    // Commit the geo before doing the skeleton.
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId), false);
-
-    if ( bExportSkeleton )
+    //-------------------------------------------------------------------------
+    // Skeleton as geometry
+    //-------------------------------------------------------------------------
+    bool bExportSkeletonAsGeometry = bExportSkeleton && HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingSkeletonAsGeometry;
+    if ( bExportSkeletonAsGeometry )
     {
-        // Export the Skeleton!
-        HAPI_NodeInfo NodeInfo;
-        FHoudiniApi::NodeInfo_Init(&NodeInfo);
+        // The skeleton lives on its own input node, the mesh stores its path in a detail attribute.
+        HAPI_NodeId SkeletonNodeId = -1;
+        HAPI_StringHandle SkeletonPathHandle = -1;
+        FString SkeletonPath;
+        if ( !FHoudiniEngineUtils::HapiCreateSkeletonGeometryFromData( SkeletalMesh, SkeletonNodeId, OutCreatedNodeIds )
+            || FHoudiniApi::GetNodePath( FHoudiniEngine::Get().GetSession(), SkeletonNodeId, -1, &SkeletonPathHandle ) != HAPI_RESULT_SUCCESS
+            || !FHoudiniEngineString( SkeletonPathHandle ).ToFString( SkeletonPath ) )
+        {
+            HOUDINI_LOG_WARNING( TEXT( "Could not create the skeleton of skeletal mesh input %s." ), *SkeletalMesh->GetName() );
+        }
+        else
+        {
+            std::string SkeletonPathStr = TCHAR_TO_UTF8( *SkeletonPath );
+            const char * SkeletonPathRaw = SkeletonPathStr.c_str();
+
+            HAPI_AttributeInfo AttributeInfo;
+            FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+            AttributeInfo.count = 1;
+            AttributeInfo.tupleSize = 1;
+            AttributeInfo.exists = true;
+            AttributeInfo.owner = HAPI_ATTROWNER_DETAIL;
+            AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+            AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+                0, HAPI_UNREAL_ATTRIB_INPUT_SKELETON_PATH, &AttributeInfo ), false );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
+                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
+                0, HAPI_UNREAL_ATTRIB_INPUT_SKELETON_PATH, &AttributeInfo,
+                &SkeletonPathRaw, 0, 1 ), false );
+        }
+    }
+
+    // Commit the geo before doing the skeleton.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId), false);
+
+    if ( bExportSkeleton && !bExportSkeletonAsGeometry )
+    {
+        // Export the Skeleton!
+        HAPI_NodeInfo NodeInfo;
+        FHoudiniApi::NodeInfo_Init(&NodeInfo);
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetNodeInfo(
             FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, &NodeInfo), false );
 
@@ -4787,6 +5333,206 @@ FHoudiniEngineUtils::HapiCreateInputNodeForSkeletalMesh(
     return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiCreateSkeletonGeometryFromData(
+    USkeletalMesh * SkeletalMesh,
+    HAPI_NodeId & SkeletonNodeId,
+    TArray< HAPI_NodeId >& OutCreatedNodeIds )
+{
+#if WITH_EDITOR
+    if ( !SkeletalMesh || SkeletalMesh->IsPendingKill() )
+        return false;
+
+    // Get the skeleton from the skeletal mesh
+    const FReferenceSkeleton& RefSkeleton = SkeletalMesh->RefSkeleton;
+    const TArray< FMeshBoneInfo > & RefBoneInfos = RefSkeleton.GetRefBoneInfo();
+    const TArray< FTransform > & RefBonePoses = RefSkeleton.GetRefBonePose();
+    int32 BoneCount = RefSkeleton.GetRawBoneNum();
+    if ( BoneCount <= 0 )
+        return false;
+
+    // Get runtime settings.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+
+    if ( HoudiniRuntimeSettings )
+    {
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+    }
+
+    // Gather the bones' rest transforms in component space, so they match the mesh's points.
+    // Parents always come before their children in the reference skeleton.
+    TArray< FTransform > ComponentSpaceTransforms;
+    ComponentSpaceTransforms.SetNumUninitialized( BoneCount );
+
+    TArray< float > BonePositions;
+    BonePositions.SetNumUninitialized( BoneCount * 3 );
+    TArray< float > BoneTransforms;
+    BoneTransforms.SetNumUninitialized( BoneCount * 9 );
+    TArray< std::string > BoneNames;
+    BoneNames.SetNum( BoneCount );
+
+    // One line primitive from each bone's parent to the bone.
+    TArray< int32 > BoneVertices;
+    BoneVertices.Reserve( BoneCount * 2 );
+
+    for ( int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex )
+    {
+        const FMeshBoneInfo & CurrentBone = RefBoneInfos[ BoneIndex ];
+        if ( CurrentBone.ParentIndex >= 0 && CurrentBone.ParentIndex < BoneIndex )
+        {
+            ComponentSpaceTransforms[ BoneIndex ] = RefBonePoses[ BoneIndex ] * ComponentSpaceTransforms[ CurrentBone.ParentIndex ];
+            BoneVertices.Add( CurrentBone.ParentIndex );
+            BoneVertices.Add( BoneIndex );
+        }
+        else
+        {
+            ComponentSpaceTransforms[ BoneIndex ] = RefBonePoses[ BoneIndex ];
+        }
+
+        const FTransform & BoneTransform = ComponentSpaceTransforms[ BoneIndex ];
+        FVector Position = BoneTransform.GetTranslation() / GeneratedGeometryScaleFactor;
+        FQuat Rotation = BoneTransform.GetRotation();
+        FVector Scale = BoneTransform.GetScale3D();
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            // Same conversion as the mesh's points and as TranslateUnrealTransform.
+            Swap( Position.Y, Position.Z );
+            Swap( Rotation.Y, Rotation.Z );
+            Rotation = FQuat( -Rotation.X, -Rotation.Y, -Rotation.Z, Rotation.W );
+            Swap( Scale.Y, Scale.Z );
+        }
+
+        BonePositions[ BoneIndex * 3 + 0 ] = Position.X;
+        BonePositions[ BoneIndex * 3 + 1 ] = Position.Y;
+        BonePositions[ BoneIndex * 3 + 2 ] = Position.Z;
+
+        // The transform attribute is a row major 3x3 matrix, each row being a scaled axis of the bone.
+        const FVector Axes[ 3 ] =
+        {
+            Rotation.RotateVector( FVector::ForwardVector ) * Scale.X,
+            Rotation.RotateVector( FVector::RightVector ) * Scale.Y,
+            Rotation.RotateVector( FVector::UpVector ) * Scale.Z
+        };
+
+        for ( int32 AxisIdx = 0; AxisIdx < 3; ++AxisIdx )
+        {
+            BoneTransforms[ BoneIndex * 9 + AxisIdx * 3 + 0 ] = Axes[ AxisIdx ].X;
+            BoneTransforms[ BoneIndex * 9 + AxisIdx * 3 + 1 ] = Axes[ AxisIdx ].Y;
+            BoneTransforms[ BoneIndex * 9 + AxisIdx * 3 + 2 ] = Axes[ AxisIdx ].Z;
+        }
+
+        FHoudiniEngineUtils::ConvertUnrealString( CurrentBone.ExportName, BoneNames[ BoneIndex ] );
+    }
+
+    // Create the input node for the skeleton.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
+        FHoudiniEngine::Get().GetSession(), &SkeletonNodeId, "skeleton" ), false );
+
+    if ( !FHoudiniEngineUtils::IsHoudiniNodeValid( SkeletonNodeId ) )
+        return false;
+
+    OutCreatedNodeIds.AddUnique( FHoudiniEngineUtils::HapiGetParentNodeId( SkeletonNodeId ) );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), SkeletonNodeId, nullptr ), false );
+
+    HAPI_GeoInfo DisplayGeoInfo;
+    FHoudiniApi::GeoInfo_Init(&DisplayGeoInfo);
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetDisplayGeoInfo(
+        FHoudiniEngine::Get().GetSession(), SkeletonNodeId, &DisplayGeoInfo ), false );
+
+    HAPI_PartInfo Part;
+    FHoudiniApi::PartInfo_Init(&Part);
+    Part.id = 0;
+    Part.nameSH = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_POINT ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_PRIM ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_DETAIL ] = 0;
+    Part.vertexCount = BoneVertices.Num();
+    Part.faceCount = BoneVertices.Num() / 2;
+    Part.pointCount = BoneCount;
+    Part.type = HAPI_PARTTYPE_MESH;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0, &Part ), false );
+
+    // Positions.
+    HAPI_AttributeInfo AttributeInfoPoint;
+    FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+    AttributeInfoPoint.count = BoneCount;
+    AttributeInfoPoint.tupleSize = 3;
+    AttributeInfoPoint.exists = true;
+    AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+    AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+    AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+        HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+        HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+        BonePositions.GetData(), 0, AttributeInfoPoint.count ), false );
+
+    // Rest transforms.
+    HAPI_AttributeInfo AttributeInfoTransform = AttributeInfoPoint;
+    AttributeInfoTransform.tupleSize = 9;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+        HAPI_UNREAL_ATTRIB_BONE_TRANSFORM, &AttributeInfoTransform ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+        HAPI_UNREAL_ATTRIB_BONE_TRANSFORM, &AttributeInfoTransform,
+        BoneTransforms.GetData(), 0, AttributeInfoTransform.count ), false );
+
+    // Bone names.
+    TArray< const char * > BoneNamesRaw;
+    BoneNamesRaw.SetNumUninitialized( BoneCount );
+    for ( int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex )
+        BoneNamesRaw[ BoneIndex ] = BoneNames[ BoneIndex ].c_str();
+
+    HAPI_AttributeInfo AttributeInfoName = AttributeInfoPoint;
+    AttributeInfoName.tupleSize = 1;
+    AttributeInfoName.storage = HAPI_STORAGETYPE_STRING;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+        HAPI_ATTRIB_NAME, &AttributeInfoName ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+        HAPI_ATTRIB_NAME, &AttributeInfoName,
+        BoneNamesRaw.GetData(), 0, AttributeInfoName.count ), false );
+
+    // Hierarchy.
+    if ( Part.faceCount > 0 )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+            BoneVertices.GetData(), 0, BoneVertices.Num() ), false );
+
+        TArray< int32 > FaceCounts;
+        FaceCounts.Init( 2, Part.faceCount );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+            FaceCounts.GetData(), 0, FaceCounts.Num() ), false );
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId ), false );
+#endif
+
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiCreateSkeletonFromData(
     HAPI_NodeId HostAssetId,
@@ -5244,6 +5990,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     // Make sure rendering is done - so we are not changing data being used by collision drawing.
     FlushRenderingCommands();
 
+    // Resolve the many optional attributes probed below with one name query per part and owner.
+    FHoudiniScopedAttributeDirectory ScopedAttributeDirectory;
+
     // Get runtime settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
     check( HoudiniRuntimeSettings );
@@ -5816,11 +6565,6 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
             if ( bRequireSplit )
             {
-                // Buffer for all vertex indices used for split groups.
-                // We need this to figure out all vertex indices that are not part of them. 
-                TArray< int32 > AllSplitVertexList;
-                AllSplitVertexList.SetNumZeroed( PartVertexList.Num() );
-
                 // Buffer for all face indices used for split groups.
                 // We need this to figure out all face indices that are not part of them.
                 TArray< int32 > AllSplitFaceIndices;
@@ -5830,20 +6574,20 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 // Store them here so we can remove them afterwards
                 TArray< int32 > InvalidGroupNameIndices;
 
-                // Extract the vertices/faces for each of the split groups
+                // Extract the vertices/faces for all the split groups at once
+                TArray< TArray< int32 > > SplitGroupVertexLists;
+                TArray< TArray< int32 > > SplitGroupFaceLists;
+                TArray< int32 > SplitGroupVertexCounts;
+                FHoudiniEngineUtils::HapiGetVertexListsForGroups(
+                    AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, SplitGroupNames, PartVertexList,
+                    SplitGroupVertexLists, SplitGroupFaceLists, SplitGroupVertexCounts,
+                    AllSplitFaceIndices );
+
                 for ( int32 SplitIdx = 0; SplitIdx < SplitGroupNames.Num(); SplitIdx++ )
                 {
-                    FString GroupName = SplitGroupNames[ SplitIdx ];
-
-                    // New vertex list just for this group.
-                    TArray< int32 > GroupVertexList;
-                    TArray< int32 > AllFaceList;
-
-                    // Extract vertex indices for this split.
-                    GroupVertexListCount = FHoudiniEngineUtils::HapiGetVertexListForGroup(
-                        AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, GroupName, PartVertexList, GroupVertexList,
-                        AllSplitVertexList, AllFaceList, AllSplitFaceIndices, PartInfo.isInstanced );
+                    const FString & GroupName = SplitGroupNames[ SplitIdx ];
 
+                    GroupVertexListCount = SplitGroupVertexCounts.IsValidIndex( SplitIdx ) ? SplitGroupVertexCounts[ SplitIdx ] : 0;
                     if ( GroupVertexListCount <= 0 )
                     {
                         // This group doesn't have vertices/faces, mark it as invalid
@@ -5858,9 +6602,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     }
 
                     // If list is not empty, we store it for this group - this will define new mesh.
-                    GroupSplitFaces.Add( GroupName, GroupVertexList );
+                    GroupSplitFaces.Add( GroupName, MoveTemp( SplitGroupVertexLists[ SplitIdx ] ) );
                     GroupSplitFaceCounts.Add( GroupName, GroupVertexListCount );
-                    GroupSplitFaceIndices.Add( GroupName, AllFaceList );
+                    GroupSplitFaceIndices.Add( GroupName, MoveTemp( SplitGroupFaceLists[ SplitIdx ] ) );
                 }
 
                 if ( InvalidGroupNameIndices.Num() > 0 )
@@ -5882,31 +6626,22 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                 // We also need to figure out / construct vertex list for everything that's not in a split group
                 TArray< int32 > GroupSplitFacesRemaining;
-                GroupSplitFacesRemaining.Init( -1, PartVertexList.Num() );
-                bool bMainSplitGroup = false;
-                GroupVertexListCount = 0;
-
                 TArray< int32 > GroupSplitFaceIndicesRemaining;
-                for ( int32 SplitVertexIdx = 0; SplitVertexIdx < AllSplitVertexList.Num(); SplitVertexIdx++ )
-                {
-                    if ( AllSplitVertexList[ SplitVertexIdx ] == 0 )
-                    {
-                        // This is unused index, we need to add it to unused vertex list.
-                        GroupSplitFacesRemaining[ SplitVertexIdx ] = PartVertexList[ SplitVertexIdx ];
-                        bMainSplitGroup = true;
-                        GroupVertexListCount++;
-                    }
-                }
-
                 for ( int32 SplitFaceIdx = 0; SplitFaceIdx < AllSplitFaceIndices.Num(); SplitFaceIdx++ )
                 {
-                    if ( AllSplitFaceIndices[ SplitFaceIdx ] == 0 )
-                    {
-                        // This is unused face, we need to add it to unused faces list.
-                        GroupSplitFaceIndicesRemaining.Add( SplitFaceIdx );
-                    }
+                    if ( AllSplitFaceIndices[ SplitFaceIdx ] != 0 || !PartVertexList.IsValidIndex( SplitFaceIdx * 3 + 2 ) )
+                        continue;
+
+                    // This is unused face, we need to add it and its vertices to the unused lists.
+                    GroupSplitFaceIndicesRemaining.Add( SplitFaceIdx );
+                    GroupSplitFacesRemaining.Add( PartVertexList[ SplitFaceIdx * 3 + 0 ] );
+                    GroupSplitFacesRemaining.Add( PartVertexList[ SplitFaceIdx * 3 + 1 ] );
+                    GroupSplitFacesRemaining.Add( PartVertexList[ SplitFaceIdx * 3 + 2 ] );
                 }
 
+                bool bMainSplitGroup = GroupSplitFacesRemaining.Num() > 0;
+                GroupVertexListCount = GroupSplitFacesRemaining.Num();
+
                 // We store the remaining geo vertex list as a special name (main geo)
                 // and make sure its treated before the collider meshes
                 if ( bMainSplitGroup )
@@ -6216,550 +6951,460 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     continue;
                 }
 
-                // Load existing raw model. This will be empty as we are constructing a new mesh.
-                FRawMesh RawMesh;
+                // The LOD's geometry is built straight into its mesh description.
+                FMeshDescription MeshDescription;
+                FStaticMeshAttributes MeshAttributes( MeshDescription );
+                MeshAttributes.Register();
+
+                // Vertex instances of the split's wedges, in the fixed winding order, and the per face data
+                // the polygons are created from once the materials are known.
+                TArray< FVertexInstanceID > WedgeVertexInstanceIDs;
+                TArray< int32 > FaceMaterialIndices;
+                TArray< uint32 > FaceSmoothingMasks;
 
                 int32 SplitGroupFaceCount = SplitGroupFaceIndices.Num();
-                if (!bRebuildStaticMesh)
+                const FMeshDescription * ExistingMeshDescription = bRebuildStaticMesh ? nullptr : StaticMesh->GetMeshDescription( SrcModelIdx );
+                const bool bRebuildMeshDescription = !ExistingMeshDescription || ExistingMeshDescription->Polygons().Num() != SplitGroupFaceCount;
+                if ( !bRebuildMeshDescription )
                 {
                     // We dont need to rebuild the mesh (because the geometry hasn't changed, but the materials have)
-                    // So we can just load the old data into the Raw mesh and reuse it.
-                    SrcModel->LoadRawMesh(RawMesh);
+                    // So we can reuse the old mesh description and only reassign its polygon groups.
+                    MeshDescription = *ExistingMeshDescription;
                 }
                 else
                 {
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    // NORMALS AND TANGENTS
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    TArray< float > SplitGroupNormals;
-                    // No need to read the normals if we'll recompute them after
-                    bool bReadNormals = HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;                
-                    if ( bReadNormals )
+                    // The wedges are written straight from the part's attribute data into the vertex instances,
+                    // swapping the axes and fixing the winding order on the way.
+                    const bool bFlipWinding = ( ImportAxis == HRSAI_Unreal );
+                    auto ConvertVector = [ ImportAxis ]( const float * Tuple )
                     {
-                        if ( PartNormals.Num() <= 0 )
-                        {
-                            // Retrieve normal data for this part
-                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                                PartInfo.id, HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals );
-                        }
+                        // We need to flip Z and Y coordinate
+                        if ( ImportAxis == HRSAI_Unreal )
+                            return FVector( Tuple[ 0 ], Tuple[ 2 ], Tuple[ 1 ] );
 
-                        // See if we need to transfer normal point attributes to vertex attributes.
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoNormals, PartNormals, SplitGroupNormals );
-                    }
+                        return FVector( Tuple[ 0 ], Tuple[ 1 ], Tuple[ 2 ] );
+                    };
 
-                    TArray< float > SplitGroupTangentU;
-                    TArray< float > SplitGroupTangentV;
-                    // No need to read the tangents if we always want to recompute them
-                    bool bReadTangents = HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
-                    if (bReadTangents)
+                    const int32 SplitGroupWedgeCount = SplitGroupVertexList.Num();
+
+                    //--------------------------------------------------------------------------------------------------------------------- 
+                    // POSITIONS
+                    //--------------------------------------------------------------------------------------------------------------------- 
+
+                    // We may already have gotten the positions when creating the ucx collisions
+                    if ( PartPositions.Num() <= 0 )
                     {
-                        if (PartTangentU.Num() <= 0)
+                        // Retrieve position data.
+                        if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                            PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions ) )
                         {
-                            // Retrieve TangentU data for this part
-                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
-                                HAPI_UNREAL_ATTRIB_TANGENTU, AttribInfoTangentU, PartTangentU );
-                        }
+                            // Error retrieving positions.
+                            HOUDINI_LOG_WARNING(
+                                TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] unable to retrieve position data ")
+                                TEXT("- skipping."),
+                                ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, SplitId, *SplitGroupName );
 
-                        // Transfer tangentu point attributes to the vertices if needed.
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoTangentU, PartTangentU, SplitGroupTangentU);
+                            if ( bStaticMeshCreated )
+                                StaticMesh->MarkPendingKill();
 
-                        if (PartTangentV.Num() <= 0)
-                        {
-                            // Retrieve TangentV data for this part
-                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
-                                HAPI_UNREAL_ATTRIB_TANGENTV, AttribInfoTangentV, PartTangentV);
+                            break;
                         }
-
-                        // Transfer tangentv point attributes to the vertices if needed.
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoTangentV, PartTangentV, SplitGroupTangentV);
                     }
 
-                    // We need to generate tangents if we have normals but we dont have tangentu or tangentv attributes
-                    bool bGenerateTangents = ( SplitGroupNormals.Num() > 0 ) && ( SplitGroupTangentU.Num() <= 0 || SplitGroupTangentV.Num() <= 0 );
-                    if ( bGenerateTangents && ( HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always ) )
-                    {
-                        // No need to generate tangents if unreal will recompute them after
-                        bGenerateTangents = false;
-                    }
+                    //--------------------------------------------------------------------------------------------------------------------- 
+                    //  VERTICES AND VERTEX INSTANCES
+                    //--------------------------------------------------------------------------------------------------------------------- 
 
-                    // Transfer normals.
-                    int32 WedgeNormalCount = SplitGroupNormals.Num() / 3;
+                    //
+                    // Because of the splits, we don't need to declare all the points in the Part, 
+                    // but only the ones that are currently used by the split's faces.
+                    // IndicesMapper maps the Part's point indices to the split's vertex ids:
+                    // - Points unused by the split are set to -1
+                    // - Used points are set to the id of the vertex created for them
+                    //
+                    TArray< int32 > IndicesMapper;
+                    IndicesMapper.Init( -1, PartInfo.pointCount );
 
-                    // Ensure the number of Normal values is correct
-                    if ( SplitGroupNormals.Num() > 0
-                        && !SplitGroupNormals.IsValidIndex( (WedgeNormalCount - 1) * 3 + 2 ) )
-                    {
-                        // Ignore normals
-                        WedgeNormalCount = 0;
-                        HOUDINI_LOG_WARNING(TEXT("Invalid normal count detected - Skipping normals."));
-                    }
+                    TVertexAttributesRef< FVector > VertexPositions = MeshAttributes.GetVertexPositions();
+                    MeshDescription.ReserveNewVertexInstances( SplitGroupWedgeCount );
+                    WedgeVertexInstanceIDs.Init( FVertexInstanceID::Invalid, SplitGroupWedgeCount );
 
-                    // Transfer the normals and generate the tangents if needed
-                    RawMesh.WedgeTangentZ.SetNumZeroed( WedgeNormalCount );
-                    for ( int32 WedgeTangentZIdx = 0; WedgeTangentZIdx < WedgeNormalCount; ++WedgeTangentZIdx )
+                    int32 DegenerateFaceCount = 0;
+                    for ( int32 FaceIdx = 0; FaceIdx < SplitGroupWedgeCount / 3; ++FaceIdx )
                     {
-                        FVector WedgeTangentZ;
-                        WedgeTangentZ.X = SplitGroupNormals[ WedgeTangentZIdx * 3 + 0 ];
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // We need to flip Z and Y coordinate
-                            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
-                            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
-                        }
-                        else
+                        static const int32 FlippedCorners[ 3 ] = { 0, 2, 1 };
+
+                        // The Part's points of the face's corners, in the fixed winding order.
+                        int32 CornerPointIndices[ 3 ];
+                        bool bValidFace = true;
+                        for ( int32 CornerIdx = 0; CornerIdx < 3; ++CornerIdx )
                         {
-                            WedgeTangentZ.Y = SplitGroupNormals[ WedgeTangentZIdx * 3 + 1 ];
-                            WedgeTangentZ.Z = SplitGroupNormals[ WedgeTangentZIdx * 3 + 2 ];
+                            CornerPointIndices[ CornerIdx ] = SplitGroupVertexList[ FaceIdx * 3 + ( bFlipWinding ? FlippedCorners[ CornerIdx ] : CornerIdx ) ];
+                            bValidFace &= IndicesMapper.IsValidIndex( CornerPointIndices[ CornerIdx ] )
+                                && PartPositions.IsValidIndex( CornerPointIndices[ CornerIdx ] * 3 + 2 );
                         }
 
-                        RawMesh.WedgeTangentZ[ WedgeTangentZIdx ] = WedgeTangentZ;
-
-                        // If we need to generate tangents.
-                        if ( bGenerateTangents )
+                        // Ensure the indices are valid
+                        if ( !bValidFace )
                         {
-                            FVector TangentX, TangentY;
-                            WedgeTangentZ.FindBestAxisVectors( TangentX, TangentY );
+                            // Invalid face index.
+                            HOUDINI_LOG_MESSAGE(
+                                TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] has some invalid face index "),
+                                ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, SplitId, *SplitGroupName );
 
-                            RawMesh.WedgeTangentX.Add( TangentX );
-                            RawMesh.WedgeTangentY.Add( TangentY );
+                            continue;
                         }
-                    }
-
-                    // Only add tangents if we have some and do not plan on generating them.
-                    // We also need to make sure that the number of tangents matches the number of normals
-                    bool bAddTangents = !bGenerateTangents && bReadTangents;
-                    int32 WedgeTangentUCount = SplitGroupTangentU.Num() / 3;
-                    int32 WedgeTangentVCount = SplitGroupTangentV.Num() / 3;
-                    if ( WedgeTangentUCount != WedgeNormalCount || WedgeTangentVCount != WedgeNormalCount )
-                        bAddTangents = false;
 
-                    if ( bAddTangents )
-                    {
-                        // Transfer tangents if we have them and they're valid
-                        RawMesh.WedgeTangentX.SetNumZeroed(WedgeTangentUCount);
-                        for (int32 WedgeTangentUIdx = 0; WedgeTangentUIdx < WedgeTangentUCount; ++WedgeTangentUIdx)
+                        FVertexID CornerVertexIDs[ 3 ];
+                        for ( int32 CornerIdx = 0; CornerIdx < 3; ++CornerIdx )
                         {
-                            FVector WedgeTangentX;
-                            WedgeTangentX.X = SplitGroupTangentU[WedgeTangentUIdx * 3 + 0];
-                            if (ImportAxis == HRSAI_Unreal)
+                            const int32 PointIdx = CornerPointIndices[ CornerIdx ];
+                            if ( IndicesMapper[ PointIdx ] < 0 )
                             {
-                                // We need to flip Z and Y coordinate
-                                WedgeTangentX.Y = SplitGroupTangentU[WedgeTangentUIdx * 3 + 2];
-                                WedgeTangentX.Z = SplitGroupTangentU[WedgeTangentUIdx * 3 + 1];
-                            }
-                            else
-                            {
-                                WedgeTangentX.Y = SplitGroupTangentU[WedgeTangentUIdx * 3 + 1];
-                                WedgeTangentX.Z = SplitGroupTangentU[WedgeTangentUIdx * 3 + 2];
+                                // This point was not yet declared in the split
+                                const FVertexID VertexID = MeshDescription.CreateVertex();
+                                VertexPositions[ VertexID ] = ConvertVector( &PartPositions[ PointIdx * 3 ] ) * GeneratedGeometryScaleFactor;
+                                IndicesMapper[ PointIdx ] = VertexID.GetValue();
                             }
 
-                            RawMesh.WedgeTangentX[WedgeTangentUIdx] = WedgeTangentX;
+                            CornerVertexIDs[ CornerIdx ] = FVertexID( IndicesMapper[ PointIdx ] );
                         }
 
-                        RawMesh.WedgeTangentY.SetNumZeroed(WedgeTangentVCount);
-                        for (int32 WedgeTangentVIdx = 0; WedgeTangentVIdx < WedgeTangentVCount; ++WedgeTangentVIdx)
+                        const FVector & Position0 = VertexPositions[ CornerVertexIDs[ 0 ] ];
+                        const FVector & Position1 = VertexPositions[ CornerVertexIDs[ 1 ] ];
+                        const FVector & Position2 = VertexPositions[ CornerVertexIDs[ 2 ] ];
+
+                        // Strict equality will not detect properly all the degenerated triangles, we need to use Equals here
+                        if ( Position0.Equals( Position1, THRESH_POINTS_ARE_SAME )
+                            || Position0.Equals( Position2, THRESH_POINTS_ARE_SAME )
+                            || Position1.Equals( Position2, THRESH_POINTS_ARE_SAME ) )
                         {
-                            FVector WedgeTangentY;
-                            WedgeTangentY.X = SplitGroupTangentV[WedgeTangentVIdx * 3 + 0];
-                            if (ImportAxis == HRSAI_Unreal)
-                            {
-                                // We need to flip Z and Y coordinate
-                                WedgeTangentY.Y = SplitGroupTangentV[WedgeTangentVIdx * 3 + 2];
-                                WedgeTangentY.Z = SplitGroupTangentV[WedgeTangentVIdx * 3 + 1];
-                            }
-                            else
-                            {
-                                WedgeTangentY.Y = SplitGroupTangentV[WedgeTangentVIdx * 3 + 1];
-                                WedgeTangentY.Z = SplitGroupTangentV[WedgeTangentVIdx * 3 + 2];
-                            }
+                            DegenerateFaceCount++;
 
-                            RawMesh.WedgeTangentY[WedgeTangentVIdx] = WedgeTangentY;
+                            // A polygon can't use the same vertex twice, the build removes the other degenerates.
+                            if ( CornerVertexIDs[ 0 ] == CornerVertexIDs[ 1 ] || CornerVertexIDs[ 0 ] == CornerVertexIDs[ 2 ] || CornerVertexIDs[ 1 ] == CornerVertexIDs[ 2 ] )
+                                continue;
                         }
+
+                        for ( int32 CornerIdx = 0; CornerIdx < 3; ++CornerIdx )
+                            WedgeVertexInstanceIDs[ FaceIdx * 3 + CornerIdx ] = MeshDescription.CreateVertexInstance( CornerVertexIDs[ CornerIdx ] );
                     }
 
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //  VERTEX COLORS AND ALPHAS
-                    //---------------------------------------------------------------------------------------------------------------------                                     
-                    TArray< float > SplitGroupColors;
-                    if ( PartColors.Num() <= 0 )
+                    // We need to check if this mesh contains only degenerate triangles.
+                    if ( DegenerateFaceCount == SplitGroupFaceCount )
                     {
-                        // Retrieve color data
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors );
-                    }
+                        // This mesh contains only degenerate triangles, there's nothing we can do.
+                        if ( bStaticMeshCreated )
+                            StaticMesh->MarkPendingKill();
 
-                    // See if we need to transfer color point attributes to vertex attributes.
-                    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                        SplitGroupVertexList, AttribInfoColors, PartColors, SplitGroupColors );
+                        continue;
+                    }
 
-                    TArray< float > SplitGroupAlphas;
-                    if ( PartAlphas.Num() <= 0 )
+                    // Calls the function for the vertex instance of each wedge that belongs to a polygon.
+                    auto ForEachWedgeVertexInstance = [ & ]( TFunctionRef< void( FVertexInstanceID ) > VertexInstanceFunc )
                     {
-                        // Retrieve alpha data
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas );
-                    }
+                        for ( const FVertexInstanceID & VertexInstanceID : WedgeVertexInstanceIDs )
+                        {
+                            if ( VertexInstanceID != FVertexInstanceID::Invalid )
+                                VertexInstanceFunc( VertexInstanceID );
+                        }
+                    };
 
-                    // See if we need to transfer alpha point attributes to vertex attributes.
-                    FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                        SplitGroupVertexList, AttribInfoAlpha, PartAlphas, SplitGroupAlphas );
+                    //--------------------------------------------------------------------------------------------------------------------- 
+                    // NORMALS AND TANGENTS
+                    //--------------------------------------------------------------------------------------------------------------------- 
+                    TVertexInstanceAttributesRef< FVector > VertexInstanceNormals = MeshAttributes.GetVertexInstanceNormals();
+                    TVertexInstanceAttributesRef< FVector > VertexInstanceTangents = MeshAttributes.GetVertexInstanceTangents();
+                    TVertexInstanceAttributesRef< float > VertexInstanceBinormalSigns = MeshAttributes.GetVertexInstanceBinormalSigns();
 
-                    // Transfer colors and alphas to the raw mesh
-                    if ( AttribInfoColors.exists && ( AttribInfoColors.tupleSize > 0 ) )
+                    int32 WedgeNormalCount = 0;
+                    // No need to read the normals if we'll recompute them after
+                    bool bReadNormals = HoudiniRuntimeSettings->RecomputeNormalsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;                
+                    if ( bReadNormals )
                     {
-                        int32 WedgeColorsCount = SplitGroupColors.Num() / AttribInfoColors.tupleSize;
-
-                        // Ensure the number of color values is correct
-                        if (!SplitGroupColors.IsValidIndex( (WedgeColorsCount - 1) * 3 + 2) )
+                        if ( PartNormals.Num() <= 0 )
                         {
-                            // Ignore colors
-                            WedgeColorsCount = 0;
-                            HOUDINI_LOG_WARNING(TEXT("Invalid vertex color count detected - Skipping colors."));
+                            // Retrieve normal data for this part
+                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                                PartInfo.id, HAPI_UNREAL_ATTRIB_NORMAL, AttribInfoNormals, PartNormals );
                         }
 
-                        RawMesh.WedgeColors.SetNumZeroed( WedgeColorsCount );
-                        for ( int32 WedgeColorIdx = 0; WedgeColorIdx < WedgeColorsCount; ++WedgeColorIdx )
+                        if ( AttribInfoNormals.exists && AttribInfoNormals.tupleSize >= 3 )
                         {
-                            FLinearColor WedgeColor;
-                            WedgeColor.R = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 0 ], 0.0f, 1.0f );
-                            WedgeColor.G = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 1 ], 0.0f, 1.0f );
-                            WedgeColor.B = FMath::Clamp(
-                                SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 2 ], 0.0f, 1.0f );
-
-                            if( AttribInfoAlpha.exists )
-                            {
-                                WedgeColor.A = FMath::Clamp( SplitGroupAlphas[ WedgeColorIdx ], 0.0f, 1.0f );
-                            }
-                            else if ( AttribInfoColors.tupleSize == 4 )
-                            {
-                                // We have alpha.
-                                WedgeColor.A = FMath::Clamp(
-                                    SplitGroupColors[ WedgeColorIdx * AttribInfoColors.tupleSize + 3 ], 0.0f, 1.0f );
-                            }
-                            else
+                            WedgeNormalCount = FHoudiniEngineUtils::ForEachSplitWedgeAttribute(
+                                SplitGroupVertexList, SplitGroupFaceIndices, AttribInfoNormals, PartNormals, bFlipWinding,
+                                [ & ]( int32 WedgeIdx, const float * Normal )
+                                {
+                                    if ( WedgeVertexInstanceIDs[ WedgeIdx ] != FVertexInstanceID::Invalid )
+                                        VertexInstanceNormals[ WedgeVertexInstanceIDs[ WedgeIdx ] ] = ConvertVector( Normal );
+                                } );
+
+                            // Ensure the number of Normal values is correct
+                            if ( WedgeNormalCount != SplitGroupWedgeCount )
                             {
-                                WedgeColor.A = 1.0f;
+                                // Ignore normals
+                                WedgeNormalCount = 0;
+                                ForEachWedgeVertexInstance( [ & ]( FVertexInstanceID VertexInstanceID )
+                                {
+                                    VertexInstanceNormals[ VertexInstanceID ] = FVector::ZeroVector;
+                                } );
+                                HOUDINI_LOG_WARNING(TEXT("Invalid normal count detected - Skipping normals."));
                             }
-
-                            // Convert linear color to fixed color.
-                            RawMesh.WedgeColors[ WedgeColorIdx ] = WedgeColor.ToFColor( false );
                         }
                     }
-                    else
-                    {
-                        // No Colors or Alphas, init colors to White
-                        FColor DefaultWedgeColor = FLinearColor::White.ToFColor( false );
-                        int32 WedgeColorsCount = RawMesh.WedgeIndices.Num();
-                        if ( WedgeColorsCount > 0 )
-                            RawMesh.WedgeColors.Init( DefaultWedgeColor, WedgeColorsCount );
-                    }
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //  FACE SMOOTHING
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // Retrieve face smoothing data.
-                    if ( PartFaceSmoothingMasks.Num() <= 0 )
-                    {
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, MarshallingAttributeNameFaceSmoothingMask.c_str(),
-                            AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks );
-                    }
 
-                    // Set face smoothing masks.
-                    RawMesh.FaceSmoothingMasks.SetNumZeroed( SplitGroupFaceCount );
-                    if ( PartFaceSmoothingMasks.Num() )
+                    // No need to read the tangents if we always want to recompute them
+                    bool bReadTangents = HoudiniRuntimeSettings->RecomputeTangentsFlag != EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always;
+                    if (bReadTangents)
                     {
-                        int32 ValidFaceIdx = 0;
-                        for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
+                        if (PartTangentU.Num() <= 0)
                         {
-                            int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
-                            if ( WedgeCheck == -1 )
-                                continue;
+                            // Retrieve TangentU data for this part
+                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                                HAPI_UNREAL_ATTRIB_TANGENTU, AttribInfoTangentU, PartTangentU );
+                        }
 
-                            RawMesh.FaceSmoothingMasks[ ValidFaceIdx ] = PartFaceSmoothingMasks[ VertexIdx / 3 ];
-                            ValidFaceIdx++;
+                        if (PartTangentV.Num() <= 0)
+                        {
+                            // Retrieve TangentV data for this part
+                            FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                                HAPI_UNREAL_ATTRIB_TANGENTV, AttribInfoTangentV, PartTangentV);
                         }
                     }
 
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //  UVS
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // Extract all UV sets
-                    TArray< TArray< float > > SplitGroupUVs;
-                    SplitGroupUVs.SetNumZeroed( MAX_STATIC_TEXCOORDS );
+                    bool bHasTangents = bReadTangents
+                        && AttribInfoTangentU.exists && AttribInfoTangentU.tupleSize >= 3
+                        && AttribInfoTangentV.exists && AttribInfoTangentV.tupleSize >= 3;
 
-                    if ( PartUVs.Num() && PartUVs[0].Num() <= 0 )
+                    // We need to generate tangents if we have normals but we dont have tangentu or tangentv attributes
+                    bool bGenerateTangents = ( WedgeNormalCount > 0 ) && !bHasTangents;
+                    if ( bGenerateTangents && ( HoudiniRuntimeSettings->RecomputeTangentsFlag == EHoudiniRuntimeSettingsRecomputeFlag::HRSRF_Always ) )
                     {
-                        // Retrieve all the UVs sets for this part
-                        FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
-                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
-                            AttribInfoUVs, PartUVs );
+                        // No need to generate tangents if unreal will recompute them after
+                        bGenerateTangents = false;
                     }
 
-                    // See if we need to transfer uv point attributes to vertex attributes.
-                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+                    if ( bGenerateTangents )
                     {
-                        FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
-                            SplitGroupVertexList, AttribInfoUVs[ TexCoordIdx ], PartUVs[ TexCoordIdx ], SplitGroupUVs[ TexCoordIdx ] );
+                        ForEachWedgeVertexInstance( [ & ]( FVertexInstanceID VertexInstanceID )
+                        {
+                            FVector TangentX, TangentY;
+                            VertexInstanceNormals[ VertexInstanceID ].FindBestAxisVectors( TangentX, TangentY );
+                            VertexInstanceTangents[ VertexInstanceID ] = TangentX;
+                            VertexInstanceBinormalSigns[ VertexInstanceID ] = FVector::DotProduct(
+                                FVector::CrossProduct( VertexInstanceNormals[ VertexInstanceID ], TangentX ), TangentY ) < 0.0f ? -1.0f : 1.0f;
+                        } );
                     }
-
-                    // Transfer UVs to the Raw Mesh
-                    int32 UVChannelCount = 0;
-                    int32 LightMapUVChannel = 0;
-                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
+                    else if ( bHasTangents && WedgeNormalCount > 0 )
                     {
-                        TArray< float > & TextureCoordinate = SplitGroupUVs[ TexCoordIdx ];
-                        int32 WedgeUVCount = TextureCoordinate.Num() / 2;
-
-                        if ( TextureCoordinate.Num() > 0 && TextureCoordinate.IsValidIndex((WedgeUVCount - 1) * 2 + 1) )
-                        {
-                            RawMesh.WedgeTexCoords[ TexCoordIdx ].SetNumZeroed( WedgeUVCount );
-                            for ( int32 WedgeUVIdx = 0; WedgeUVIdx < WedgeUVCount; ++WedgeUVIdx )
+                        // Transfer tangents if we have them and they're valid
+                        int32 WedgeTangentUCount = FHoudiniEngineUtils::ForEachSplitWedgeAttribute(
+                            SplitGroupVertexList, SplitGroupFaceIndices, AttribInfoTangentU, PartTangentU, bFlipWinding,
+                            [ & ]( int32 WedgeIdx, const float * TangentU )
                             {
-                                // We need to flip V coordinate when it's coming from HAPI.
-                                FVector2D WedgeUV;
-                                WedgeUV.X = TextureCoordinate[ WedgeUVIdx * 2 + 0 ];
-                                WedgeUV.Y = 1.0f - TextureCoordinate[ WedgeUVIdx * 2 + 1 ];
-
-                                RawMesh.WedgeTexCoords[ TexCoordIdx ][ WedgeUVIdx ] = WedgeUV;
-                            }
-
-                            UVChannelCount++;
+                                if ( WedgeVertexInstanceIDs[ WedgeIdx ] != FVertexInstanceID::Invalid )
+                                    VertexInstanceTangents[ WedgeVertexInstanceIDs[ WedgeIdx ] ] = ConvertVector( TangentU );
+                            } );
+
+                        // The binormal only gives the sign of the tangent basis.
+                        int32 WedgeTangentVCount = FHoudiniEngineUtils::ForEachSplitWedgeAttribute(
+                            SplitGroupVertexList, SplitGroupFaceIndices, AttribInfoTangentV, PartTangentV, bFlipWinding,
+                            [ & ]( int32 WedgeIdx, const float * TangentV )
+                            {
+                                const FVertexInstanceID VertexInstanceID = WedgeVertexInstanceIDs[ WedgeIdx ];
+                                if ( VertexInstanceID != FVertexInstanceID::Invalid )
+                                {
+                                    VertexInstanceBinormalSigns[ VertexInstanceID ] = FVector::DotProduct(
+                                        FVector::CrossProduct( VertexInstanceNormals[ VertexInstanceID ], VertexInstanceTangents[ VertexInstanceID ] ),
+                                        ConvertVector( TangentV ) ) < 0.0f ? -1.0f : 1.0f;
+                                }
+                            } );
 
-                            if ( UVChannelCount <= 2 )
-                                LightMapUVChannel = TexCoordIdx;
-                        }
-                        else
+                        // We also need to make sure that the number of tangents matches the number of normals
+                        if ( WedgeTangentUCount != WedgeNormalCount || WedgeTangentVCount != WedgeNormalCount )
                         {
-                            RawMesh.WedgeTexCoords[ TexCoordIdx ].Empty();
+                            ForEachWedgeVertexInstance( [ & ]( FVertexInstanceID VertexInstanceID )
+                            {
+                                VertexInstanceTangents[ VertexInstanceID ] = FVector::ZeroVector;
+                                VertexInstanceBinormalSigns[ VertexInstanceID ] = 1.0f;
+                            } );
                         }
                     }
 
-                    // We have to have at least one UV channel. If there's none, create one with zero data.
-                    if (UVChannelCount == 0)
-                        RawMesh.WedgeTexCoords[ 0 ].SetNumZeroed( SplitGroupVertexListCount );
-
-                    // Set the lightmap Coordinate Index
-                    // If we have more than one UV set, the 2nd set will be used for lightmaps by convention
-                    // If not, the first UV set will be used
-                    StaticMesh->LightMapCoordinateIndex = LightMapUVChannel;
-
                     //--------------------------------------------------------------------------------------------------------------------- 
-                    // LIGHTMAP RESOLUTION
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    // Get lightmap resolution (if present).
-                    if ( PartLightMapResolutions.Num() <= 0 )
+                    //  VERTEX COLORS AND ALPHAS
+                    //---------------------------------------------------------------------------------------------------------------------                                     
+                    if ( PartColors.Num() <= 0 )
                     {
-                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+                        // Retrieve color data
+                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
                             AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, MarshallingAttributeNameLightmapResolution.c_str(),
-                            AttribLightmapResolution, PartLightMapResolutions );
+                            PartInfo.id, HAPI_UNREAL_ATTRIB_COLOR, AttribInfoColors, PartColors );
                     }
 
-                    // make sure the mesh has a new lighting guid
-                    StaticMesh->LightingGuid = FGuid::NewGuid();
-
-                    //--------------------------------------------------------------------------------------------------------------------- 
-                    //  INDICES
-                    //--------------------------------------------------------------------------------------------------------------------- 
-
-                    //
-                    // Because of the splits, we don't need to declare all the vertices in the Part, 
-                    // but only the one that are currently used by the split's faces.
-                    // The indicesMapper array is used to map those indices from Part Vertices to Split Vertices.
-                    // We also keep track of the needed vertices index to declare them easily afterwards.
-                    //
-
-                    // IndicesMapper:
-                    // Maps index values for all vertices in the Part:
-                    // - Vertices unused by the split will be set to -1
-                    // - Used vertices will have their value set to the "NewIndex"
-                    // So that IndicesMapper[ oldIndex ] => newIndex
-                    TArray< int32 > IndicesMapper;
-                    IndicesMapper.Init( -1, SplitGroupVertexList.Num() );
-                    int32 CurrentMapperIndex = 0;
-
-                    // Neededvertices:
-                    // Contains the old index of the needed vertices for the current split
-                    // NeededVertices[ newIndex ] => oldIndex
-                    TArray< int32 > NeededVertices;
-                    RawMesh.WedgeIndices.SetNumZeroed( SplitGroupVertexListCount );
-
-                    int32 ValidVertexId = 0;
-                    for ( int32 VertexIdx = 0; VertexIdx < SplitGroupVertexList.Num(); VertexIdx += 3 )
+                    if ( PartAlphas.Num() <= 0 )
                     {
-                        int32 WedgeCheck = SplitGroupVertexList[ VertexIdx + 0 ];
-                        if ( WedgeCheck == -1 )
-                            continue;
-
-                        int32 WedgeIndices[ 3 ] = 
-                        {
-                            SplitGroupVertexList[ VertexIdx + 0 ],
-                            SplitGroupVertexList[ VertexIdx + 1 ],
-                            SplitGroupVertexList[ VertexIdx + 2 ]
-                        };
-
-                        // Ensure the indices are valid
-                        if ( !IndicesMapper.IsValidIndex( WedgeIndices[0] )
-                            || !IndicesMapper.IsValidIndex( WedgeIndices[1] )
-                            || !IndicesMapper.IsValidIndex( WedgeIndices[2] ) )
-                        {
-                            // Invalid face index.
-                            HOUDINI_LOG_MESSAGE(
-                                TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] has some invalid face index "),
-                                ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, SplitId, *SplitGroupName );
-
-                            continue;
-                        }
-
-                        // Converting Old (Part) Indices to New (Split) Indices:
-                        for ( int32 i = 0; i < 3; i++ )
-                        {
-                            if ( IndicesMapper[ WedgeIndices[ i ] ] < 0 )
-                            {
-                                // This old index was not yet "converted" to a new index
-                                NeededVertices.Add( WedgeIndices[ i ] );
-
-                                IndicesMapper[ WedgeIndices[ i ] ] = CurrentMapperIndex;
-                                CurrentMapperIndex++;
-                            }
-                               
-                            // Replace the old index with the new one
-                            WedgeIndices[ i ] = IndicesMapper[ WedgeIndices[ i ] ];
-                        }
-
-                        if ( !RawMesh.WedgeIndices.IsValidIndex(ValidVertexId + 2) )
-                            break;
+                        // Retrieve alpha data
+                        FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                            PartInfo.id, HAPI_UNREAL_ATTRIB_ALPHA, AttribInfoAlpha, PartAlphas );
+                    }
 
-                        if ( ImportAxis == HRSAI_Unreal )
+                    // Transfer colors and alphas to the vertex instances, they default to white.
+                    TVertexInstanceAttributesRef< FVector4 > VertexInstanceColors = MeshAttributes.GetVertexInstanceColors();
+                    if ( AttribInfoColors.exists && ( AttribInfoColors.tupleSize > 0 ) )
+                    {
+                        const int32 ColorTupleSize = AttribInfoColors.tupleSize;
+                        int32 WedgeColorsCount = 0;
+                        if ( ColorTupleSize >= 3 )
                         {
-                            // Flip wedge indices to fix the winding order.
-                            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 2 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 1 ];
-
-                            // Check if we need to patch UVs.
-                            for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
-                            {
-                                if ( RawMesh.WedgeTexCoords[ TexCoordIdx ].IsValidIndex( ValidVertexId + 2) )
+                            WedgeColorsCount = FHoudiniEngineUtils::ForEachSplitWedgeAttribute(
+                                SplitGroupVertexList, SplitGroupFaceIndices, AttribInfoColors, PartColors, bFlipWinding,
+                                [ & ]( int32 WedgeIdx, const float * Color )
                                 {
-                                    Swap( RawMesh.WedgeTexCoords[ TexCoordIdx ][ ValidVertexId + 1 ],
-                                        RawMesh.WedgeTexCoords[ TexCoordIdx ][ ValidVertexId + 2 ] );
-                                }
-                            }
-
-                            // Check if we need to patch colors.
-                            if ( RawMesh.WedgeColors.IsValidIndex(ValidVertexId + 2) )
-                                Swap( RawMesh.WedgeColors[ ValidVertexId + 1 ], RawMesh.WedgeColors[ ValidVertexId + 2 ] );
+                                    if ( WedgeVertexInstanceIDs[ WedgeIdx ] == FVertexInstanceID::Invalid )
+                                        return;
 
-                            // Check if we need to patch Normals and tangents.
-                            if ( RawMesh.WedgeTangentZ.IsValidIndex(ValidVertexId + 2) )
-                                Swap( RawMesh.WedgeTangentZ[ ValidVertexId + 1 ], RawMesh.WedgeTangentZ[ ValidVertexId + 2 ] );
+                                    FLinearColor WedgeColor;
+                                    WedgeColor.R = FMath::Clamp( Color[ 0 ], 0.0f, 1.0f );
+                                    WedgeColor.G = FMath::Clamp( Color[ 1 ], 0.0f, 1.0f );
+                                    WedgeColor.B = FMath::Clamp( Color[ 2 ], 0.0f, 1.0f );
 
-                            if ( RawMesh.WedgeTangentX.IsValidIndex(ValidVertexId + 2) )
-                                Swap( RawMesh.WedgeTangentX[ ValidVertexId + 1 ], RawMesh.WedgeTangentX[ ValidVertexId + 2 ] );
+                                    // We have alpha, an alpha attribute overrides it below.
+                                    WedgeColor.A = ( ColorTupleSize == 4 ) ? FMath::Clamp( Color[ 3 ], 0.0f, 1.0f ) : 1.0f;
 
-                            if ( RawMesh.WedgeTangentY.IsValidIndex(ValidVertexId + 2) )
-                                Swap ( RawMesh.WedgeTangentY[ ValidVertexId + 1 ], RawMesh.WedgeTangentY[ ValidVertexId + 2 ] );
+                                    // Quantize the color as the static mesh vertex colors will be.
+                                    VertexInstanceColors[ WedgeVertexInstanceIDs[ WedgeIdx ] ] = FVector4( FLinearColor::FromSRGBColor( WedgeColor.ToFColor( false ) ) );
+                                } );
                         }
-                        else if ( ImportAxis == HRSAI_Houdini )
+
+                        // Ensure the number of color values is correct
+                        if ( WedgeColorsCount != SplitGroupWedgeCount )
                         {
-                            // Dont flip the wedge indices
-                            RawMesh.WedgeIndices[ ValidVertexId + 0 ] = WedgeIndices[ 0 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 1 ] = WedgeIndices[ 1 ];
-                            RawMesh.WedgeIndices[ ValidVertexId + 2 ] = WedgeIndices[ 2 ];
+                            // Ignore colors
+                            ForEachWedgeVertexInstance( [ & ]( FVertexInstanceID VertexInstanceID )
+                            {
+                                VertexInstanceColors[ VertexInstanceID ] = FVector4( FLinearColor::White );
+                            } );
+                            HOUDINI_LOG_WARNING(TEXT("Invalid vertex color count detected - Skipping colors."));
                         }
+                        else if ( AttribInfoAlpha.exists )
+                        {
+                            FHoudiniEngineUtils::ForEachSplitWedgeAttribute(
+                                SplitGroupVertexList, SplitGroupFaceIndices, AttribInfoAlpha, PartAlphas, bFlipWinding,
+                                [ & ]( int32 WedgeIdx, const float * Alpha )
+                                {
+                                    if ( WedgeVertexInstanceIDs[ WedgeIdx ] == FVertexInstanceID::Invalid )
+                                        return;
 
-                        ValidVertexId += 3;
+                                    const FLinearColor WedgeAlpha( 0.0f, 0.0f, 0.0f, FMath::Clamp( Alpha[ 0 ], 0.0f, 1.0f ) );
+                                    VertexInstanceColors[ WedgeVertexInstanceIDs[ WedgeIdx ] ].W = WedgeAlpha.ToFColor( false ).A / 255.0f;
+                                } );
+                        }
                     }
 
                     //--------------------------------------------------------------------------------------------------------------------- 
-                    // POSITIONS
+                    //  FACE SMOOTHING
                     //--------------------------------------------------------------------------------------------------------------------- 
 
-                    // We may already have gotten the positions when creating the ucx collisions
-                    if ( PartPositions.Num() <= 0 )
+                    // Retrieve face smoothing data.
+                    if ( PartFaceSmoothingMasks.Num() <= 0 )
                     {
-                        // Retrieve position data.
-                        if ( !FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
                             AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
-                            PartInfo.id, HAPI_UNREAL_ATTRIB_POSITION, AttribInfoPositions, PartPositions ) )
+                            PartInfo.id, MarshallingAttributeNameFaceSmoothingMask.c_str(),
+                            AttribInfoFaceSmoothingMasks, PartFaceSmoothingMasks );
+                    }
+
+                    // Face smoothing masks, they are turned into hard edges once the polygons are created.
+                    FaceSmoothingMasks.SetNumZeroed( SplitGroupFaceCount );
+                    if ( PartFaceSmoothingMasks.Num() )
+                    {
+                        for ( int32 FaceIdx = 0; FaceIdx < SplitGroupFaceCount; ++FaceIdx )
                         {
-                            // Error retrieving positions.
-                            HOUDINI_LOG_WARNING(
-                                TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] unable to retrieve position data ")
-                                TEXT("- skipping."),
-                                ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, SplitId, *SplitGroupName );
+                            int32 SplitFaceIndex = SplitGroupFaceIndices[ FaceIdx ];
+                            if ( PartFaceSmoothingMasks.IsValidIndex( SplitFaceIndex ) )
+                                FaceSmoothingMasks[ FaceIdx ] = PartFaceSmoothingMasks[ SplitFaceIndex ];
+                        }
+                    }
 
-                            if ( bStaticMeshCreated )
-                                StaticMesh->MarkPendingKill();
+                    //--------------------------------------------------------------------------------------------------------------------- 
+                    //  UVS
+                    //--------------------------------------------------------------------------------------------------------------------- 
 
-                            break;
-                        }
+                    if ( PartUVs.Num() && PartUVs[0].Num() <= 0 )
+                    {
+                        // Retrieve all the UVs sets for this part
+                        FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
+                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id,
+                            AttribInfoUVs, PartUVs );
                     }
 
-                    //
-                    // Transfer vertex positions:
-                    //
-                    // Because of the split, we're only interested in the needed vertices.
-                    // Instead of declaring all the Positions, we'll only declare the vertices
-                    // needed by the current split.
-                    //
-                    int32 VertexPositionsCount = NeededVertices.Num();
-                    RawMesh.VertexPositions.SetNumZeroed( VertexPositionsCount );
-                    for ( int32 VertexPositionIdx = 0; VertexPositionIdx < VertexPositionsCount; ++VertexPositionIdx )
+                    // Transfer UVs to the vertex instances, missing channels below the last valid one are left zero.
+                    TVertexInstanceAttributesRef< FVector2D > VertexInstanceUVs = MeshAttributes.GetVertexInstanceUVs();
+                    VertexInstanceUVs.SetNumIndices( MAX_STATIC_TEXCOORDS );
+
+                    int32 UVChannelCount = 0;
+                    int32 LightMapUVChannel = 0;
+                    int32 LastUVChannel = 0;
+                    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx )
                     {
-                        int32 NeededVertexIndex = NeededVertices[ VertexPositionIdx ];
-                        if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
-                        {
-                            // Error retrieving positions.
-                            HOUDINI_LOG_WARNING(
-                                TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s], Split [%d %s] invalid position/index data ")
-                                TEXT("- skipping."),
-                                ObjectInfo.nodeId, *ObjectName, GeoInfo.nodeId, PartIdx, *PartName, SplitId, *SplitGroupName);
-                        }
+                        const HAPI_AttributeInfo & AttribInfoUV = AttribInfoUVs[ TexCoordIdx ];
+                        if ( !AttribInfoUV.exists || AttribInfoUV.tupleSize < 2 )
+                            continue;
 
-                        FVector VertexPosition;
-                        VertexPosition.X = PartPositions[ NeededVertexIndex * 3 + 0 ] * GeneratedGeometryScaleFactor;
-                        if ( ImportAxis == HRSAI_Unreal )
-                        {
-                            // We need to swap Z and Y coordinate here.                            
-                            VertexPosition.Y = PartPositions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
-                            VertexPosition.Z = PartPositions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                        }
-                        else if ( ImportAxis == HRSAI_Houdini )
+                        int32 WedgeUVCount = FHoudiniEngineUtils::ForEachSplitWedgeAttribute(
+                            SplitGroupVertexList, SplitGroupFaceIndices, AttribInfoUV, PartUVs[ TexCoordIdx ], bFlipWinding,
+                            [ & ]( int32 WedgeIdx, const float * UV )
+                            {
+                                // We need to flip V coordinate when it's coming from HAPI.
+                                if ( WedgeVertexInstanceIDs[ WedgeIdx ] != FVertexInstanceID::Invalid )
+                                    VertexInstanceUVs.Set( WedgeVertexInstanceIDs[ WedgeIdx ], TexCoordIdx, FVector2D( UV[ 0 ], 1.0f - UV[ 1 ] ) );
+                            } );
+
+                        if ( WedgeUVCount <= 0 || WedgeUVCount != SplitGroupWedgeCount )
                         {
-                            // No swap required.
-                            VertexPosition.Y = PartPositions[ NeededVertexIndex * 3 + 1 ] * GeneratedGeometryScaleFactor;
-                            VertexPosition.Z = PartPositions[ NeededVertexIndex * 3 + 2 ] * GeneratedGeometryScaleFactor;
+                            ForEachWedgeVertexInstance( [ & ]( FVertexInstanceID VertexInstanceID )
+                            {
+                                VertexInstanceUVs.Set( VertexInstanceID, TexCoordIdx, FVector2D::ZeroVector );
+                            } );
+                            continue;
                         }
 
-                        RawMesh.VertexPositions[ VertexPositionIdx ] = VertexPosition;
+                        UVChannelCount++;
+                        LastUVChannel = TexCoordIdx;
+
+                        if ( UVChannelCount <= 2 )
+                            LightMapUVChannel = TexCoordIdx;
                     }
 
-                    // We need to check if this mesh contains only degenerate triangles.
-                    if ( FHoudiniEngineUtils::CountDegenerateTriangles( RawMesh ) == SplitGroupFaceCount )
-                    {
-                        // This mesh contains only degenerate triangles, there's nothing we can do.
-                        if ( bStaticMeshCreated )
-                            StaticMesh->MarkPendingKill();
+                    // We have to have at least one UV channel. If there's none, the first one is kept with zero data.
+                    VertexInstanceUVs.SetNumIndices( LastUVChannel + 1 );
 
-                        continue;
+                    // Set the lightmap Coordinate Index
+                    // If we have more than one UV set, the 2nd set will be used for lightmaps by convention
+                    // If not, the first UV set will be used
+                    StaticMesh->LightMapCoordinateIndex = LightMapUVChannel;
+
+                    //--------------------------------------------------------------------------------------------------------------------- 
+                    // LIGHTMAP RESOLUTION
+                    //--------------------------------------------------------------------------------------------------------------------- 
+
+                    // Get lightmap resolution (if present).
+                    if ( PartLightMapResolutions.Num() <= 0 )
+                    {
+                        FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
+                            AssetId, ObjectInfo.nodeId, GeoInfo.nodeId,
+                            PartInfo.id, MarshallingAttributeNameLightmapResolution.c_str(),
+                            AttribLightmapResolution, PartLightMapResolutions );
                     }
+
+                    // make sure the mesh has a new lighting guid
+                    StaticMesh->LightingGuid = FGuid::NewGuid();
                 }
 
                 //--------------------------------------------------------------------------------------------------------------------- 
@@ -6806,7 +7451,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     if ( PartFaceMaterialAttributeOverrides.Num() > 0 && AttribFaceMaterials.owner == HAPI_ATTROWNER_DETAIL )
                     {
                         FString SingleFaceMaterial = PartFaceMaterialAttributeOverrides[ 0 ];
-                        PartFaceMaterialAttributeOverrides.Init( SingleFaceMaterial, SplitGroupVertexList.Num() / 3 );
+                        PartFaceMaterialAttributeOverrides.Init( SingleFaceMaterial, PartInfo.faceCount );
                     }
                 }
 
@@ -6821,7 +7466,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     if ( !IsLOD || ( IsLOD && LodIndex == 0 ) )
                         StaticMesh->StaticMaterials.Empty();
 
-                    RawMesh.FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
+                    FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
                     for ( int32 FaceIdx = 0; FaceIdx < SplitGroupFaceIndices.Num(); ++FaceIdx )
                     {
                         int32 SplitFaceIndex = SplitGroupFaceIndices[ FaceIdx ];
@@ -6906,7 +7551,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         }
 
                         // Update the Face Material on the mesh
-                        RawMesh.FaceMaterialIndices[ FaceIdx ] = CurrentFaceMaterialIdx;
+                        FaceMaterialIndices[ FaceIdx ] = CurrentFaceMaterialIdx;
                     }
                 }
                 else
@@ -6919,7 +7564,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             UMaterialInterface * Material = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get());
 
                             // We have only one material.
-                            RawMesh.FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
+                            FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
 
                             // Get id of this single material.
                             FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
@@ -6949,8 +7594,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             // Get default Houdini material.
                             UMaterial * MaterialDefault = FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get();
 
-                            // Reset Rawmesh material face assignments.
-                            RawMesh.FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
+                            // Reset material face assignments.
+                            FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
                             for ( int32 FaceIdx = 0; FaceIdx < SplitGroupFaceIndices.Num(); ++FaceIdx )
                             {
                                 int32 SplitFaceIndex = SplitGroupFaceIndices[ FaceIdx ];                                                
@@ -6965,7 +7610,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 if ( FoundUnrealMatIndex )
                                 {
                                     // This material has been mapped already, just assign the mat index
-                                    RawMesh.FaceMaterialIndices[ FaceIdx ] = *FoundUnrealMatIndex;
+                                    FaceMaterialIndices[ FaceIdx ] = *FoundUnrealMatIndex;
                                     continue;
                                 }
 
@@ -6991,14 +7636,14 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 MapHoudiniMatIdToUnrealIndex.Add( MaterialId, UnrealMatIndex );
 
                                 // Update the face index
-                                RawMesh.FaceMaterialIndices[ FaceIdx ] = UnrealMatIndex;
+                                FaceMaterialIndices[ FaceIdx ] = UnrealMatIndex;
                             }
                         }
                     }
                     else
                     {
                         // No materials were found, we need to use default Houdini material.
-                        RawMesh.FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
+                        FaceMaterialIndices.SetNumZeroed( SplitGroupFaceCount );
 
                         UMaterialInterface * Material = Cast<UMaterialInterface>(FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get());
                         FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
@@ -7015,8 +7660,74 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     }
                 }
 
+                //--------------------------------------------------------------------------------------------------------------------- 
+                // POLYGONS
+                //---------------------------------------------------------------------------------------------------------------------
+
+                // Polygons are grouped by material, the group id being the material index.
+                if ( bRebuildMeshDescription )
+                {
+                    TArray< uint32 > PolygonSmoothingMasks;
+                    PolygonSmoothingMasks.Reserve( SplitGroupFaceCount );
+                    for ( int32 FaceIdx = 0; FaceIdx < SplitGroupFaceCount; ++FaceIdx )
+                    {
+                        TArray< FVertexInstanceID > PolygonVertexInstanceIDs;
+                        for ( int32 CornerIdx = 0; CornerIdx < 3; ++CornerIdx )
+                        {
+                            const int32 WedgeIdx = FaceIdx * 3 + CornerIdx;
+                            if ( WedgeVertexInstanceIDs.IsValidIndex( WedgeIdx ) && WedgeVertexInstanceIDs[ WedgeIdx ] != FVertexInstanceID::Invalid )
+                                PolygonVertexInstanceIDs.Add( WedgeVertexInstanceIDs[ WedgeIdx ] );
+                        }
+
+                        // Invalid and collapsed faces didn't get vertex instances.
+                        if ( PolygonVertexInstanceIDs.Num() != 3 )
+                            continue;
+
+                        const int32 MaterialIndex = FaceMaterialIndices.IsValidIndex( FaceIdx ) ? FaceMaterialIndices[ FaceIdx ] : 0;
+                        const FPolygonGroupID PolygonGroupID = FindOrCreatePolygonGroup( MeshDescription, StaticMesh->StaticMaterials, MaterialIndex );
+
+                        const FPolygonID PolygonID = MeshDescription.CreatePolygon( PolygonGroupID, PolygonVertexInstanceIDs );
+                        FMeshPolygon & Polygon = MeshDescription.GetPolygon( PolygonID );
+                        MeshDescription.ComputePolygonTriangulation( PolygonID, Polygon.Triangles );
+
+                        PolygonSmoothingMasks.Add( FaceSmoothingMasks[ FaceIdx ] );
+                    }
+
+                    // The masks are indexed by polygon id, which follow the order of creation.
+                    FMeshDescriptionOperations::ConvertSmoothGroupToHardEdges( PolygonSmoothingMasks, MeshDescription );
+                }
+                else
+                {
+                    // Every face of the split is one of the kept polygons, move them to their new material's group.
+                    for ( int32 FaceIdx = 0; FaceIdx < SplitGroupFaceCount; ++FaceIdx )
+                    {
+                        const FPolygonID PolygonID( FaceIdx );
+                        if ( !MeshDescription.IsPolygonValid( PolygonID ) )
+                            continue;
+
+                        const int32 MaterialIndex = FaceMaterialIndices.IsValidIndex( FaceIdx ) ? FaceMaterialIndices[ FaceIdx ] : 0;
+                        const FPolygonGroupID PolygonGroupID = FindOrCreatePolygonGroup( MeshDescription, StaticMesh->StaticMaterials, MaterialIndex );
+                        if ( MeshDescription.GetPolygonPolygonGroup( PolygonID ) != PolygonGroupID )
+                            MeshDescription.SetPolygonPolygonGroup( PolygonID, PolygonGroupID );
+                    }
+
+                    // Remove the groups of the materials that aren't used anymore and rename the others after their slot.
+                    TArray< FPolygonGroupID > PolygonGroupIDs;
+                    for ( const FPolygonGroupID PolygonGroupID : MeshDescription.PolygonGroups().GetElementIDs() )
+                        PolygonGroupIDs.Add( PolygonGroupID );
+
+                    TPolygonGroupAttributesRef< FName > PolygonGroupMaterialSlotNames = FStaticMeshAttributes( MeshDescription ).GetPolygonGroupMaterialSlotNames();
+                    for ( const FPolygonGroupID PolygonGroupID : PolygonGroupIDs )
+                    {
+                        if ( MeshDescription.GetPolygonGroupPolygons( PolygonGroupID ).Num() <= 0 )
+                            MeshDescription.DeletePolygonGroup( PolygonGroupID );
+                        else
+                            PolygonGroupMaterialSlotNames[ PolygonGroupID ] = GetPolygonGroupMaterialSlotName( StaticMesh->StaticMaterials, PolygonGroupID.GetValue() );
+                    }
+                }
+
                 // Some mesh generation settings.
-                HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel->BuildSettings, RawMesh );
+                HoudiniRuntimeSettings->SetMeshBuildSettings( SrcModel->BuildSettings, MeshDescription );
 
                 // By default the distance field resolution should be set to 2.0
                 SrcModel->BuildSettings.DistanceFieldResolutionScale = HoudiniCookParams.GeneratedDistanceFieldResolutionScale;
@@ -7027,7 +7738,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 if ( SrcModel->BuildSettings.bGenerateLightmapUVs )
                 {
                     // See if we need to disable lightmap generation because of bad UVs.
-                    if ( FHoudiniEngineUtils::ContainsInvalidLightmapFaces( RawMesh, StaticMesh->LightMapCoordinateIndex ) )
+                    if ( FHoudiniEngineUtils::ContainsInvalidLightmapFaces( MeshDescription, StaticMesh->LightMapCoordinateIndex ) )
                     {
                         SrcModel->BuildSettings.bGenerateLightmapUVs = false;
 
@@ -7045,7 +7756,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         StaticMesh->LightMapResolution = LightMapResolutionOverride;
                 }
 
-                if ( !RawMesh.IsValidOrFixable() )
+                if ( MeshDescription.Polygons().Num() <= 0 )
                 {
                     HOUDINI_LOG_WARNING(
                         TEXT("Static Mesh Generated from Object [%d %s], Geo [%d], Part [%d %s], Split [%d, %s] is invalid!")
@@ -7058,11 +7769,10 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     continue;
                 }
 
-                // This is required due to the impeding deprecation of FRawMesh
                 // If we dont update this UE4 will crash upon deleting an asset.
                 SrcModel->StaticMeshOwner = StaticMesh;
-                // Store the new raw mesh.
-                SrcModel->SaveRawMesh(RawMesh);
+                // Store the new geometry in the LOD's mesh description.
+                CommitMeshDescription( StaticMesh, SrcModelIdx, MoveTemp( MeshDescription ) );
 
                 // Lambda for initializing a LOD level
                 auto InitLODLevel = [ & ]( const int32& LODLevelIndex )
@@ -7125,14 +7835,10 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         float screensize = -1.0;
                         if ( AttribInfoLODScreenSize.owner == HAPI_ATTROWNER_PRIM )
                         {
-                            int32 n = 0;
-                            for( ; n <  SplitGroupVertexList.Num(); n++ )
-                            {
-                                if ( SplitGroupVertexList[ n ] > 0 )
-                                    break;
-                            }
-
-                            screensize = LODScreenSizes[ n / 3 ];
+                            // Use the value of the split's first face
+                            int32 n = SplitGroupFaceIndices.Num() > 0 ? SplitGroupFaceIndices[ 0 ] : 0;
+                            if ( LODScreenSizes.IsValidIndex( n ) )
+                                screensize = LODScreenSizes[ n ];
                         }
                         else
                         {
@@ -7222,15 +7928,10 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                         {
                             // If the attribute is on primitives, we need to find
                             // the index of the prim that correspond to our split
-                            for (int32 n = 0; n < SplitGroupVertexList.Num(); n++)
-                            {
-                                if (SplitGroupVertexList[n] <= 0)
-                                    continue;
+                            if (SplitGroupFaceIndices.Num() > 0)
+                                AttrIdx = SplitGroupFaceIndices[0];
+
 
-                                AttrIdx = n / 3;
-                                break;
-                            }
-                            
                             if (!BakeNameOverrides.IsValidIndex(AttrIdx))
                                 AttrIdx = 0;
                         }
@@ -7429,47 +8130,6 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
     return true;
 }
 
-#if WITH_EDITOR
-
-bool
-FHoudiniEngineUtils::ContainsDegenerateTriangles( const FRawMesh & RawMesh )
-{
-    int32 WedgeCount = RawMesh.WedgeIndices.Num();
-    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
-    {
-        const FVector & Vertex0 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 0 ] ];
-        const FVector & Vertex1 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 1 ] ];
-        const FVector & Vertex2 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 2 ] ];
-
-        // Strict equality will not detect properly all the degenerated triangles, we need to use Equals here
-        if ( Vertex0.Equals(Vertex1, THRESH_POINTS_ARE_SAME) || Vertex0.Equals(Vertex2, THRESH_POINTS_ARE_SAME) || Vertex1.Equals(Vertex2, THRESH_POINTS_ARE_SAME) )
-            return true;
-    }
-
-    return false;
-}
-
-int32
-FHoudiniEngineUtils::CountDegenerateTriangles( const FRawMesh & RawMesh )
-{
-    int32 DegenerateTriangleCount = 0;
-    int32 WedgeCount = RawMesh.WedgeIndices.Num();
-    for ( int32 WedgeIdx = 0; WedgeIdx < WedgeCount; WedgeIdx += 3 )
-    {
-        const FVector & Vertex0 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 0 ] ];
-        const FVector & Vertex1 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 1 ] ];
-        const FVector & Vertex2 = RawMesh.VertexPositions[ RawMesh.WedgeIndices[ WedgeIdx + 2 ] ];
-
-        // Strict equality will not detect properly all the degenerated triangles, we need to use Equals here
-        if( Vertex0.Equals(Vertex1, THRESH_POINTS_ARE_SAME) || Vertex0.Equals(Vertex2, THRESH_POINTS_ARE_SAME) || Vertex1.Equals(Vertex2, THRESH_POINTS_ARE_SAME) )
-            DegenerateTriangleCount++;
-    }
-
-    return DegenerateTriangleCount;
-}
-
-#endif
-
 int32
 FHoudiniEngineUtils::TransferRegularPointAttributesToVertices(
     const TArray< int32 > & VertexList, const HAPI_AttributeInfo & AttribInfo, TArray< float > & Data)
@@ -7689,14 +8349,6 @@ FHoudiniEngineUtils::DeleteFaceMaterialArray( TArray< char * > & OutStaticMeshFa
 void
 FHoudiniEngineUtils::ExtractStringPositions( const FString & Positions, TArray< FVector > & OutPositions )
 {
-    TArray< FString > PointStrings;
-
-    static const TCHAR * PositionSeparators[] =
-    {
-        TEXT( " " ),
-        TEXT( "," ),
-    };
-
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
     float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
@@ -7708,14 +8360,29 @@ FHoudiniEngineUtils::ExtractStringPositions( const FString & Positions, TArray<
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    int32 NumCoords = Positions.ParseIntoArray( PointStrings, PositionSeparators, 2 );
-    for ( int32 CoordIdx = 0; CoordIdx < NumCoords; CoordIdx += 3 )
+    auto IsSeparator = []( TCHAR Char ) { return Char == TEXT( ' ' ) || Char == TEXT( ',' ); };
+
+    // Read the coordinates in place rather than splitting the string into one FString per coordinate.
+    const TCHAR * Current = *Positions;
+    float Coords[ 3 ];
+    int32 NumCoords = 0;
+    while ( *Current )
     {
-        FVector Position;
+        if ( IsSeparator( *Current ) )
+        {
+            ++Current;
+            continue;
+        }
+
+        Coords[ NumCoords++ ] = FCString::Atof( Current );
+        while ( *Current && !IsSeparator( *Current ) )
+            ++Current;
+
+        if ( NumCoords < 3 )
+            continue;
 
-        Position.X = FCString::Atof( *PointStrings[ CoordIdx + 0 ] );
-        Position.Y = FCString::Atof( *PointStrings[ CoordIdx + 1 ] );
-        Position.Z = FCString::Atof( *PointStrings[ CoordIdx + 2 ] );
+        NumCoords = 0;
+        FVector Position( Coords[ 0 ], Coords[ 1 ], Coords[ 2 ] );
 
         Position *= GeneratedGeometryScaleFactor;
 
@@ -7753,6 +8420,11 @@ FHoudiniEngineUtils::CreatePositionsString( const TArray< FVector > & Positions,
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
+    // Format each point in a local buffer and append it, instead of going through a temporary FString.
+    const int32 PositionBufferSize = 128;
+    TCHAR PositionBuffer[ PositionBufferSize ];
+    PositionString.Reserve( Positions.Num() * 36 );
+
     for ( int32 Idx = 0; Idx < Positions.Num(); ++Idx )
     {
         FVector Position = Positions[ Idx ];
@@ -7774,7 +8446,9 @@ FHoudiniEngineUtils::CreatePositionsString( const TArray< FVector > & Positions,
         if ( GeneratedGeometryScaleFactor != 0.0f )
             Position /= GeneratedGeometryScaleFactor;
 
-        PositionString += FString::Printf( TEXT( "%f, %f, %f " ), Position.X, Position.Y, Position.Z );
+        int32 PositionLength = FCString::Snprintf(
+            PositionBuffer, PositionBufferSize, TEXT( "%f, %f, %f " ), Position.X, Position.Y, Position.Z );
+        PositionString.AppendChars( PositionBuffer, FMath::Clamp( PositionLength, 0, PositionBufferSize - 1 ) );
     }
 }
 
@@ -8118,83 +8792,104 @@ FHoudiniEngineUtils::LoadLibHAPI( FString & StoredLibHAPILocation )
     return HAPILibraryHandle;
 }
 
-int32
-FHoudiniEngineUtils::HapiGetVertexListForGroup(
+bool
+FHoudiniEngineUtils::HapiGetVertexListsForGroups(
     HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
-    HAPI_PartId PartId, const FString & GroupName,
-    const TArray< int32 > & FullVertexList, TArray< int32 > & NewVertexList,
-    TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
-    TArray< int32 > & AllCollisionFaceIndices, const bool& isPackedPrim )
+    HAPI_PartId PartId, const TArray< FString > & GroupNames,
+    const TArray< int32 > & FullVertexList, TArray< TArray< int32 > > & GroupVertexLists,
+    TArray< TArray< int32 > > & GroupFaceLists, TArray< int32 > & GroupVertexCounts,
+    TArray< int32 > & AllGroupFaces )
 {
-    NewVertexList.Init( -1, FullVertexList.Num() );
-    int32 ProcessedWedges = 0;
+    GroupVertexLists.SetNum( GroupNames.Num() );
+    GroupFaceLists.SetNum( GroupNames.Num() );
+    GroupVertexCounts.Init( 0, GroupNames.Num() );
 
-    AllFaceList.Empty();
+    HAPI_PartInfo PartInfo;
+    FHoudiniApi::PartInfo_Init( &PartInfo );
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetPartInfo(
+        FHoudiniEngine::Get().GetSession(), GeoId, PartId, &PartInfo ), false );
 
-    TArray< int32 > PartGroupMembership;
-    FHoudiniEngineUtils::HapiGetGroupMembership(
-        AssetId, ObjectId, GeoId, PartId, HAPI_GROUPTYPE_PRIM, GroupName, PartGroupMembership );
+    int32 FaceCount = FHoudiniEngineUtils::HapiGetElementCountByGroupType( HAPI_GROUPTYPE_PRIM, PartInfo );
+    if ( FaceCount < 1 )
+        return false;
 
-    // Go through all primitives.
-    for ( int32 FaceIdx = 0; FaceIdx < PartGroupMembership.Num(); ++FaceIdx )
+    // HAPI only returns the membership of one group at a time. Each membership is fetched in the same buffer
+    // and read once, building the group's face list, its vertex list and the faces used by all groups.
+    TArray< int32 > GroupMembership;
+    GroupMembership.SetNumUninitialized( FaceCount );
+    for ( int32 GroupIdx = 0; GroupIdx < GroupNames.Num(); ++GroupIdx )
     {
-        if ( PartGroupMembership[ FaceIdx ] > 0 )
+        TArray< int32 > & GroupFaceList = GroupFaceLists[ GroupIdx ];
+        TArray< int32 > & GroupVertexList = GroupVertexLists[ GroupIdx ];
+        GroupFaceList.Reset();
+        GroupVertexList.Reset();
+
+        std::string ConvertedGroupName = TCHAR_TO_UTF8( *GroupNames[ GroupIdx ] );
+        HAPI_Result Result = HAPI_RESULT_SUCCESS;
+        if ( !PartInfo.isInstanced )
+        {
+            Result = FHoudiniApi::GetGroupMembership(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartId, HAPI_GROUPTYPE_PRIM,
+                ConvertedGroupName.c_str(), NULL, &GroupMembership[ 0 ], 0, FaceCount );
+        }
+        else
         {
-            // Add face.
-            AllFaceList.Add( FaceIdx );
+            Result = FHoudiniApi::GetGroupMembershipOnPackedInstancePart(
+                FHoudiniEngine::Get().GetSession(), GeoId, PartId, HAPI_GROUPTYPE_PRIM,
+                ConvertedGroupName.c_str(), NULL, &GroupMembership[ 0 ], 0, FaceCount );
+        }
 
-            // This face is a member of specified group.
-            if (FullVertexList.IsValidIndex(FaceIdx * 3 + 2 ) )
-            {
-                NewVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
-                NewVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
-                NewVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
-            }
+        // Groups we fail to read are left empty.
+        if ( Result != HAPI_RESULT_SUCCESS )
+            continue;
 
-            // Mark these vertex indices as used.
-            if ( AllVertexList.IsValidIndex( FaceIdx * 3 + 2 ) )
-            {
-                AllVertexList[ FaceIdx * 3 + 0 ] = 1;
-                AllVertexList[ FaceIdx * 3 + 1 ] = 1;
-                AllVertexList[ FaceIdx * 3 + 2 ] = 1;
-            }
+        for ( int32 FaceIdx = 0; FaceIdx < FaceCount; ++FaceIdx )
+        {
+            if ( GroupMembership[ FaceIdx ] <= 0 || !FullVertexList.IsValidIndex( FaceIdx * 3 + 2 ) )
+                continue;
 
-            // Mark this face as used.
-            if ( AllCollisionFaceIndices.IsValidIndex( FaceIdx ) )
-                AllCollisionFaceIndices[ FaceIdx ] = 1;
+            GroupFaceList.Add( FaceIdx );
+            GroupVertexList.Add( FullVertexList[ FaceIdx * 3 + 0 ] );
+            GroupVertexList.Add( FullVertexList[ FaceIdx * 3 + 1 ] );
+            GroupVertexList.Add( FullVertexList[ FaceIdx * 3 + 2 ] );
 
-            ProcessedWedges += 3;
+            if ( AllGroupFaces.IsValidIndex( FaceIdx ) )
+                AllGroupFaces[ FaceIdx ] = 1;
         }
+
+        GroupVertexCounts[ GroupIdx ] = GroupVertexList.Num();
     }
 
-    return ProcessedWedges;
+    return true;
 }
 
 
 #if WITH_EDITOR
 
 bool
-FHoudiniEngineUtils::ContainsInvalidLightmapFaces( const FRawMesh & RawMesh, int32 LightmapSourceIdx )
+FHoudiniEngineUtils::ContainsInvalidLightmapFaces( const FMeshDescription & MeshDescription, int32 LightmapSourceIdx )
 {
-    const TArray< FVector2D > & LightmapUVs = RawMesh.WedgeTexCoords[ LightmapSourceIdx ];
-    const TArray< uint32 > & Indices = RawMesh.WedgeIndices;
-
-    if ( LightmapUVs.Num() != Indices.Num() )
+    FStaticMeshConstAttributes MeshAttributes( MeshDescription );
+    TVertexInstanceAttributesConstRef< FVector2D > VertexInstanceUVs = MeshAttributes.GetVertexInstanceUVs();
+    if ( LightmapSourceIdx < 0 || LightmapSourceIdx >= VertexInstanceUVs.GetNumIndices() )
     {
-        // This is invalid raw mesh; by design we consider that it contains invalid lightmap faces.
+        // The lightmap UV set is missing; by design we consider that it contains invalid lightmap faces.
         return true;
     }
 
-    for ( int32 Idx = 0; Idx < Indices.Num(); Idx += 3 )
+    for ( const FPolygonID PolygonID : MeshDescription.Polygons().GetElementIDs() )
     {
-        const FVector2D & uv0 = LightmapUVs[ Idx + 0 ];
-        const FVector2D & uv1 = LightmapUVs[ Idx + 1 ];
-        const FVector2D & uv2 = LightmapUVs[ Idx + 2 ];
-
-        if ( uv0 == uv1 && uv1 == uv2 )
+        for ( const FMeshTriangle & Triangle : MeshDescription.GetPolygonTriangles( PolygonID ) )
         {
-            // Detect invalid lightmap face, can stop.
-            return true;
+            const FVector2D & uv0 = VertexInstanceUVs.Get( Triangle.GetVertexInstanceID( 0 ), LightmapSourceIdx );
+            const FVector2D & uv1 = VertexInstanceUVs.Get( Triangle.GetVertexInstanceID( 1 ), LightmapSourceIdx );
+            const FVector2D & uv2 = VertexInstanceUVs.Get( Triangle.GetVertexInstanceID( 2 ), LightmapSourceIdx );
+
+            if ( uv0 == uv1 && uv1 == uv2 )
+            {
+                // Detect invalid lightmap face, can stop.
+                return true;
+            }
         }
     }
 
@@ -8204,25 +8899,6 @@ FHoudiniEngineUtils::ContainsInvalidLightmapFaces( const FRawMesh & RawMesh, int
 
 #endif
 
-int32
-FHoudiniEngineUtils::CountUVSets( const FRawMesh & RawMesh )
-{
-    int32 UVSetCount = 0;
-
-#if WITH_EDITOR
-
-    for ( int32 TexCoordIdx = 0; TexCoordIdx < MAX_MESH_TEXTURE_COORDS; ++TexCoordIdx )
-    {
-        const TArray< FVector2D > & WedgeTexCoords = RawMesh.WedgeTexCoords[ TexCoordIdx ];
-        if ( WedgeTexCoords.Num() > 0 )
-            UVSetCount++;
-    }
-
-#endif // WITH_EDITOR
-
-    return UVSetCount;
-}
-
 const FString
 FHoudiniEngineUtils::GetStatusString( HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity )
 {
@@ -9102,6 +9778,24 @@ FHoudiniEngineUtils::GetGenericAttributeList(
     int32 PrimitiveIndex )
 {
     HAPI_NodeId NodeId = GeoPartObject.HapiGeoGetNodeId();
+
+    // Parts without any attribute using that prefix don't need their attributes listed.
+    if ( FHoudiniPartAttributeDirectory * Directory = FHoudiniScopedAttributeDirectory::FindOrAdd( NodeId, GeoPartObject.GetPartId() ) )
+    {
+        bool bHasPrefixedAttribute = false;
+        for ( const FString & AttributeName : Directory->Names[ AttributeOwner ] )
+        {
+            if ( AttributeName.StartsWith( GenericAttributePrefix, ESearchCase::IgnoreCase ) )
+            {
+                bHasPrefixedAttribute = true;
+                break;
+            }
+        }
+
+        if ( !bHasPrefixedAttribute )
+            return 0;
+    }
+
     HAPI_PartInfo PartInfo;
     FHoudiniApi::PartInfo_Init(&PartInfo);
     if ( !GeoPartObject.HapiPartGetInfo( PartInfo ) )
@@ -10422,11 +11116,70 @@ FHoudiniEngineUtils::GetAllUVAttributesInfoAndTexCoords(
     }
 }
 
+/** Convex hulls of the collision groups already decomposed, by hash of their geometry. **/
+static TMap< uint64, TArray< FKConvexElem > > ConvexCollisionCache;
+
+/** Hash of a collision group's triangles, and of the settings changing its hulls. **/
+static uint64
+GetConvexCollisionHash( const TArray< float >& Positions, const TArray< int32 >& SplitGroupVertexList, const bool& MultiHullDecomp )
+{
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+
+    TArray< float > GroupPositions;
+    GroupPositions.Reserve( SplitGroupVertexList.Num() * 3 + 3 );
+    for ( const int32 Index : SplitGroupVertexList )
+    {
+        if ( Positions.IsValidIndex( Index * 3 + 2 ) )
+            GroupPositions.Append( Positions.GetData() + Index * 3, 3 );
+    }
+
+    GroupPositions.Add( MultiHullDecomp ? 1.0f : 0.0f );
+    if ( HoudiniRuntimeSettings )
+    {
+        GroupPositions.Add( HoudiniRuntimeSettings->GeneratedGeometryScaleFactor );
+        GroupPositions.Add( (float) HoudiniRuntimeSettings->ImportAxis );
+    }
+
+    return CityHash64( (const char *) GroupPositions.GetData(), GroupPositions.Num() * sizeof( float ) );
+}
+
 bool
 FHoudiniEngineUtils::AddConvexCollisionToAggregate(
     const TArray<float>& Positions, const TArray<int32>& SplitGroupVertexList,
     const bool& MultiHullDecomp, FKAggregateGeom& AggregateCollisionGeo )
 {
+#if WITH_EDITOR
+    // Groups with identical geometry reuse the hulls that were already decomposed
+    const uint64 Hash = GetConvexCollisionHash( Positions, SplitGroupVertexList, MultiHullDecomp );
+    if ( const TArray< FKConvexElem > * CachedConvexElems = ConvexCollisionCache.Find( Hash ) )
+    {
+        AggregateCollisionGeo.ConvexElems.Append( *CachedConvexElems );
+        return true;
+    }
+
+    // We are using Unreal's DecomposeMeshToHulls() so we have to create a fake BodySetup
+    UBodySetup* DecompBodySetup = MultiHullDecomp ? NewObject<UBodySetup>() : nullptr;
+
+    TArray< FKConvexElem > ConvexElems;
+    if ( !ComputeConvexCollision( Positions, SplitGroupVertexList, MultiHullDecomp, DecompBodySetup, ConvexElems ) )
+        return false;
+
+    // Keep the cache from growing indefinitely over a long session
+    if ( ConvexCollisionCache.Num() >= 4096 )
+        ConvexCollisionCache.Empty();
+
+    ConvexCollisionCache.Add( Hash, ConvexElems );
+
+    AggregateCollisionGeo.ConvexElems.Append( ConvexElems );
+#endif
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::ComputeConvexCollision(
+    const TArray<float>& Positions, const TArray<int32>& SplitGroupVertexList,
+    const bool& MultiHullDecomp, UBodySetup* DecompBodySetup, TArray< FKConvexElem >& OutConvexElems )
+{
 #if WITH_EDITOR
     // Get runtime settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
@@ -10474,7 +11227,7 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
         }
     }
 
-    if ( MultiHullDecomp && ( VertexArray.Num() >= 3 || UniqueVertexIndexes.Num() >= 3 ) )
+    if ( MultiHullDecomp && DecompBodySetup && ( VertexArray.Num() >= 3 || UniqueVertexIndexes.Num() >= 3 ) )
     {
         // creating multiple convex hull collision
         // ... this might take a while
@@ -10508,20 +11261,14 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
             }
         }
 
-        // We are using Unreal's DecomposeMeshToHulls() so we have to create a fake BodySetup
-        UBodySetup* BodySetup = NewObject<UBodySetup>();
-
         // Run actual util to do the work (if we have some valid input)
-        DecomposeMeshToHulls( BodySetup, Vertices, Indices, 8, 16 );
+        DecomposeMeshToHulls( DecompBodySetup, Vertices, Indices, 8, 16 );
 
         // If we succeed, return here
         // If not, keep going and we'll try to do a single hull decomposition
-        if ( BodySetup->AggGeom.ConvexElems.Num() > 0 )
+        if ( DecompBodySetup->AggGeom.ConvexElems.Num() > 0 )
         {
-            // Copy the convex elem to our aggregate
-            for ( int32 n = 0; n < BodySetup->AggGeom.ConvexElems.Num(); n++ )
-                AggregateCollisionGeo.ConvexElems.Add( BodySetup->AggGeom.ConvexElems[ n ] );
-
+            OutConvexElems = DecompBodySetup->AggGeom.ConvexElems;
             return true;
         }
     }
@@ -10531,7 +11278,7 @@ FHoudiniEngineUtils::AddConvexCollisionToAggregate(
     ConvexCollision.VertexData = VertexArray;
     ConvexCollision.UpdateElemBox();
 
-    AggregateCollisionGeo.ConvexElems.Add( ConvexCollision );
+    OutConvexElems.Add( ConvexCollision );
 #endif
     return true;
 }
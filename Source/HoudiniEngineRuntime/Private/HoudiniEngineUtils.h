@@ -36,8 +36,9 @@ class ALandscapeProxy;
 class AHoudiniAssetActor;
 class USplineComponent;
 class USkeletalMesh;
+class FSkeletalMeshLODModel;
 
-struct FRawMesh;
+struct FMeshDescription;
 
 DECLARE_STATS_GROUP( TEXT( "HoudiniEngine" ), STATGROUP_HoudiniEngine, STATCAT_Advanced );
 
@@ -191,6 +192,84 @@ struct HOUDINIENGINERUNTIME_API UGenericAttribute
     }
 };
 
+/** Case sensitive key functions for FString sets, Houdini attribute names are case sensitive. **/
+struct FHoudiniCaseSensitiveStringKeyFuncs : DefaultKeyFuncs< FString >
+{
+    static FORCEINLINE bool Matches( const FString & A, const FString & B )
+    {
+        return A.Equals( B, ESearchCase::CaseSensitive );
+    }
+
+    static FORCEINLINE uint32 GetKeyHash( const FString & Key )
+    {
+        return FCrc::StrCrc32< TCHAR >( *Key );
+    }
+};
+
+/** Case sensitive key functions for FString keyed maps. **/
+template < typename ValueType >
+struct THoudiniCaseSensitiveStringMapKeyFuncs : TDefaultMapKeyFuncs< FString, ValueType, false >
+{
+    static FORCEINLINE bool Matches( const FString & A, const FString & B )
+    {
+        return A.Equals( B, ESearchCase::CaseSensitive );
+    }
+
+    static FORCEINLINE uint32 GetKeyHash( const FString & Key )
+    {
+        return FCrc::StrCrc32< TCHAR >( *Key );
+    }
+};
+
+/** Attribute names of a part, per owner, and the infos of the attributes already looked up. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniPartAttributeDirectory
+{
+    TSet< FString, FHoudiniCaseSensitiveStringKeyFuncs > Names[ HAPI_ATTROWNER_MAX ];
+    TMap< FString, HAPI_AttributeInfo, FDefaultSetAllocator,
+        THoudiniCaseSensitiveStringMapKeyFuncs< HAPI_AttributeInfo > > Infos[ HAPI_ATTROWNER_MAX ];
+};
+
+/** While in scope, attribute lookups on the game thread go through a directory of each part's attributes, built with **/
+/** one GetAttributeNames call per owner, instead of probing every owner. Geometry must not be recooked in the scope. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniScopedAttributeDirectory
+{
+    FHoudiniScopedAttributeDirectory();
+    ~FHoudiniScopedAttributeDirectory();
+
+    /** Return the directory of a part, building it if needed, or null if no scope is active. **/
+    static FHoudiniPartAttributeDirectory * FindOrAdd( HAPI_NodeId GeoId, HAPI_PartId PartId );
+
+    private:
+
+        static int32 ScopeCount;
+        static TMap< uint64, FHoudiniPartAttributeDirectory > Directories;
+};
+
+/** Geometry of one skeletal mesh LOD, flattened for upload. Points are the soft skin vertices of the enabled sections,  **/
+/** skin weights are packed sparsely: InfluenceCount entries per point, non zero influences first, padded with -1 / 0. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniSkeletalMeshLODData
+{
+    /** Point positions, 3 floats per point. **/
+    TArray< float > Positions;
+
+    /** Vertex list with the winding order fixed, and the per vertex UVs (3 floats), normals (3) and colors (4). **/
+    TArray< int32 > VertexList;
+    TArray< TArray< float > > UVs;
+    TArray< float > Normals;
+    TArray< float > Colors;
+
+    /** Material index of each triangle. **/
+    TArray< int32 > FaceMaterialIds;
+
+    /** Reference skeleton bone indices and weights, InfluenceCount per point. **/
+    TArray< int32 > BoneIndices;
+    TArray< float > BoneWeights;
+    int32 InfluenceCount = 0;
+
+    int32 GetPointCount() const { return Positions.Num() / 3; }
+    int32 GetFaceCount() const { return FaceMaterialIds.Num(); }
+};
+
 struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 {
     public:
@@ -281,9 +360,6 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** Load libHAPI and return handle to it, also store location of loaded libHAPI in passed argument. **/
         static void* LoadLibHAPI( FString & StoredLibHAPILocation );
 
-        /** Helper function to count number of UV sets in raw mesh. **/
-        static int32 CountUVSets( const FRawMesh & RawMesh );
-
         /** Helper function to extract copied Houdini actor from clipboard. **/
         static AHoudiniAssetActor * LocateClipboardActor( const AActor* IgnoreActor, const FString & ClipboardText );
 
@@ -360,6 +436,21 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             FHoudiniAssetInputOutlinerMesh& OutlinerMesh,
             const float& fSplineResolution = -1.0f);
 
+        /** Return the spline resolution to use, the runtime settings' one if SplineResolution is -1. **/
+        static float GetMarshallingSplineResolution( const float & SplineResolution );
+
+        /** Return the maximum distance between sampled splines and Unreal's, 0 disables adaptive sampling. **/
+        static float GetMarshallingSplineMaxError();
+
+        /** Return a hash of the spline's control points and of the settings its samples depend on. **/
+        static uint32 GetSplineSamplingHash(
+            const USplineComponent * SplineComponent, const float & SplineResolution, const float & SplineMaxError );
+
+        /** Sample a spline at a fixed step, or adaptively if SplineMaxError is positive. Can run off the game thread. **/
+        static void SampleSpline(
+            const USplineComponent * SplineComponent, const float & SplineResolution, const float & SplineMaxError,
+            FHoudiniSplineSamples & OutSamples );
+
         static bool HapiCreateCurveInputNodeForData(
             HAPI_NodeId HostAssetId,
             HAPI_NodeId & ConnectedAssetId,
@@ -373,7 +464,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         static bool HapiCreateInputNodeForSkeletalMesh(
             HAPI_NodeId HostAssetId, USkeletalMesh * SkeletalMesh,
             HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds,
-            const bool& bExportSkeleton = true );
+            const bool& bExportSkeleton = true, const bool& bExportAllLODs = false );
+
+        /** Marshaling, flatten a skeletal mesh LOD's enabled sections, reading their soft skin vertices in place. **/
+        static bool ExtractSkeletalMeshLODData(
+            const FSkeletalMeshLODModel & LODModel,
+            const float & GeometryScaleFactor, const bool & bSwapYZ,
+            FHoudiniSkeletalMeshLODData & OutLODData );
 
         /** HAPI : Marshaling, extract skeleton and creates its Houdini equivalent - return true on success **/
         static bool HapiCreateSkeletonFromData(
@@ -382,6 +479,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
                 const HAPI_NodeInfo& SkelMeshNodeInfo,
                 TArray< HAPI_NodeId >& OutCreatedNodeIds );
 
+        /** HAPI : Marshaling, create an input node holding the skeleton as geometry: one point per bone with its name    **/
+        /** and rest transform, and one line from each bone to its parent. Return true on success.                      **/
+        static bool HapiCreateSkeletonGeometryFromData(
+                USkeletalMesh * SkeletalMesh,
+                HAPI_NodeId & SkeletonNodeId,
+                TArray< HAPI_NodeId >& OutCreatedNodeIds );
+
         /** HAPI : Marshaling, disconnect input asset from a given slot. **/
         static bool HapiDisconnectAsset( HAPI_NodeId HostAssetId, int32 InputIndex );
 
@@ -423,6 +527,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
             HAPI_PartId PartId, const char * Name );
 
+        /** HAPI : Get the info of an attribute, on any owner if Owner is HAPI_ATTROWNER_INVALID. **/
+        /** Uses the attribute directory when one is in scope. Return false on HAPI errors only. **/
+        static bool HapiGetAttributeInfo(
+            HAPI_NodeId GeoId, HAPI_PartId PartId, const char * Name,
+            HAPI_AttributeOwner Owner, HAPI_AttributeInfo & AttributeInfo );
+
         /** HAPI: Returns all the attributes of a given type for a given owner **/
         static int32 HapiGetAttributeOfType(
                 const HAPI_NodeId& AssetId, const HAPI_NodeId& ObjectId,
@@ -497,7 +607,10 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 #if WITH_EDITOR
 
         /** Helper routine to check invalid lightmap faces. **/
-        static bool ContainsInvalidLightmapFaces( const FRawMesh & RawMesh, int32 LightmapSourceIdx );
+        static bool ContainsInvalidLightmapFaces( const FMeshDescription & MeshDescription, int32 LightmapSourceIdx );
+
+        /** Replaces a LOD's mesh description and commits it, identical geometry keeps the same id so its build is found in the DDC. **/
+        static bool CommitMeshDescription( UStaticMesh * StaticMesh, int32 LODIndex, FMeshDescription && MeshDescription );
 
 #endif // WITH_EDITOR
 
@@ -510,13 +623,14 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FHoudiniGeoPartObject & HoudiniGeoPartObject,
             TArray< FTransform > & Transforms );
 
-        /** HAPI : Given vertex list, retrieve new vertex list for a specified group. **/
-        /** Return number of processed valid index vertices for this split. **/
-        static int32 HapiGetVertexListForGroup(
+        /** HAPI : Given vertex list, retrieve the vertex and face lists of all the specified prim groups.           **/
+        /** Vertex lists are compact: the 3 vertices of each face of the group's face list, in the same order.   **/
+        /** Empty groups get empty lists. Faces used by any group are set to 1 in AllGroupFaces.                  **/
+        static bool HapiGetVertexListsForGroups(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId, HAPI_NodeId GeoId,
-            HAPI_PartId PartId, const FString & GroupName, const TArray< int32 > & FullVertexList,
-            TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
-            TArray< int32 > & AllCollisionFaceIndices, const bool& isPackedPrim );
+            HAPI_PartId PartId, const TArray< FString > & GroupNames, const TArray< int32 > & FullVertexList,
+            TArray< TArray< int32 > > & GroupVertexLists, TArray< TArray< int32 > > & GroupFaceLists,
+            TArray< int32 > & GroupVertexCounts, TArray< int32 > & AllGroupFaces );
 
         /** HAPI : Retrieves the mesh sockets list for the current part **/
         static int32 AddMeshSocketToList(
@@ -546,11 +660,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             FHoudiniGeoPartObject& HoudiniGeoPartObject,
             FKAggregateGeom& AggregateCollisionGeo );
 
-        /** Add convex hull to the mesh's aggregate collision geometry **/
+        /** Add convex hull to the mesh's aggregate collision geometry, hulls of identical geometry are reused. **/
         static bool AddConvexCollisionToAggregate(
             const TArray<float>& Positions, const TArray<int32>& SplitGroupVertexList,
             const bool& MultiHullDecomp, FKAggregateGeom& AggregateCollisionGeo );
 
+        /** Computes the convex hulls of a collision group, DecompBodySetup is only needed for multi hull decomposition. **/
+        static bool ComputeConvexCollision(
+            const TArray<float>& Positions, const TArray<int32>& SplitGroupVertexList,
+            const bool& MultiHullDecomp, class UBodySetup* DecompBodySetup, TArray< FKConvexElem >& OutConvexElems );
+
         /** Add convex hull to the mesh's aggregate collision geometry **/
         static bool AddSimpleCollision(
             const FString& SplitGroupName, UStaticMesh* StaticMesh,
@@ -630,13 +749,51 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const TArray< int32 > & VertexList, const HAPI_AttributeInfo & AttribInfo, 
             const TArray< float > & Data, TArray< float >& VertexData );
 
-#if WITH_EDITOR
-
-        /** Helper routine to check if Raw Mesh contains degenerate triangles. **/
-        static bool ContainsDegenerateTriangles( const FRawMesh & RawMesh );
+        /** Visit the wedges of a split's compact VertexList, whose faces are FaceIndices in the part, with their tuple   **/
+        /** in the part's attribute Data, whatever the attribute's owner. WedgeFunc( WedgeIdx, Tuple ) writes the wedge  **/
+        /** into the caller's buffer, with the last two of each face swapped if bFlipWinding. Returns wedges visited.     **/
+        template < typename TWedgeFunc >
+        static int32 ForEachSplitWedgeAttribute(
+            const TArray< int32 > & VertexList, const TArray< int32 > & FaceIndices,
+            const HAPI_AttributeInfo & AttribInfo, const TArray< float > & Data,
+            bool bFlipWinding, TWedgeFunc WedgeFunc )
+        {
+            if ( !AttribInfo.exists || AttribInfo.tupleSize <= 0 )
+                return 0;
+
+            static const int32 FlippedCorners[ 3 ] = { 0, 2, 1 };
+            const int32 TupleSize = AttribInfo.tupleSize;
+            const int32 ElementCount = Data.Num() / TupleSize;
+            const int32 WedgeCount = FMath::Min( VertexList.Num(), FaceIndices.Num() * 3 );
+
+            int32 WedgeIdx = 0;
+            for ( ; WedgeIdx < WedgeCount; ++WedgeIdx )
+            {
+                // Index of the face and of the wedge in the part.
+                const int32 CornerIdx = WedgeIdx % 3;
+                const int32 FaceIdx = FaceIndices[ WedgeIdx / 3 ];
+
+                int32 ElementIdx = 0;
+                switch ( AttribInfo.owner )
+                {
+                    case HAPI_ATTROWNER_POINT: ElementIdx = VertexList[ WedgeIdx ]; break;
+                    case HAPI_ATTROWNER_VERTEX: ElementIdx = FaceIdx * 3 + CornerIdx; break;
+                    case HAPI_ATTROWNER_PRIM: ElementIdx = FaceIdx; break;
+                    default: break;
+                }
+
+                // Not enough data, the caller will see the wedge count is off.
+                if ( ElementIdx < 0 || ElementIdx >= ElementCount )
+                    break;
+
+                const int32 OutWedgeIdx = bFlipWinding ? WedgeIdx - CornerIdx + FlippedCorners[ CornerIdx ] : WedgeIdx;
+                WedgeFunc( OutWedgeIdx, &Data[ ElementIdx * TupleSize ] );
+            }
+
+            return WedgeIdx;
+        }
 
-        /** Helper routine to count number of degenerate triangles. **/
-        static int32 CountDegenerateTriangles( const FRawMesh & RawMesh );
+#if WITH_EDITOR
 
         /** Create helper array of material names, we use it for marshalling. **/
         static void CreateFaceMaterialArray(
@@ -664,12 +821,25 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
 
     protected:
         static FString ComputeVersionString(bool ExtraDigit);
-#if WITH_EDITOR
 
-        /** Reset streams used by the given RawMesh. **/
-        static void ResetRawMesh( FRawMesh & RawMesh );
-
-#endif // WITH_EDITOR
+        /** HAPI : Send positions to the curve SOP so it fits the CVs, then add rotation and scale attributes to them. **/
+        static bool HapiCreateFittedCurveInputNodeForData(
+            HAPI_NodeId ConnectedAssetId,
+            TArray<FVector>* Positions,
+            TArray<FQuat>* Rotations,
+            TArray<FVector>* Scales3d,
+            TArray<float>* UniformScales,
+            int32 CurveTypeValue,
+            int32 CurveMethodValue,
+            int32 CurveClosed );
+
+        /** HAPI : Add rotation, scale and uniform scale point attributes for the first NumberOfCVs points of a curve. **/
+        static bool HapiAddCurvePointAttributes(
+            HAPI_NodeId NodeId,
+            int32 NumberOfCVs,
+            const TArray<FQuat>* Rotations,
+            const TArray<FVector>* Scales3d,
+            const TArray<float>* UniformScales );
 
     public:
 
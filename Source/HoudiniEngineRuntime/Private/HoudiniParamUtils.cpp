@@ -85,6 +85,15 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
                 FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &ParmInfos[ 0 ], 0,
                 NodeInfo.parmCount ), false );
 
+        // Fetch all values and strings of the node up front, parameters read from this while being created.
+        TUniquePtr< FHoudiniParmValuesSnapshot > ValuesSnapshot =
+            MakeUnique< FHoudiniParmValuesSnapshot >( AssetInfo.nodeId, NodeInfo, ParmInfos );
+
+        // Resolve the parameter hierarchy once, instead of walking the parents of every parameter.
+        TMap< HAPI_ParmId, int32 > ParmIdToIndex;
+        TBitArray<> HiddenParameters;
+        ComputeHiddenParameters( ParmInfos, ParmIdToIndex, HiddenParameters );
+
         // Create name lookup cache
         TMap<FString, UHoudiniAssetParameter*> CurrentParametersByName;
         CurrentParametersByName.Reserve( CurrentParameters.Num() );
@@ -107,31 +116,8 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
                 continue;
             }
 
-            // If parameter is invisible, skip it.
-            if( ParmInfo.invisible )
-                continue;
-
-            // Check if any parent folder of this parameter is invisible 
-            bool SkipParm = false;
-            HAPI_ParmId ParentId = ParmInfo.parentId;
-            while( ParentId > 0 && !SkipParm )
-            {
-                if( const HAPI_ParmInfo* ParentInfoPtr = ParmInfos.FindByPredicate( [=]( const HAPI_ParmInfo& Info ) {
-                    return Info.id == ParentId;
-                } ) )
-                {
-                    if( ParentInfoPtr->invisible && ParentInfoPtr->type == HAPI_PARMTYPE_FOLDER )
-                        SkipParm = true;
-                    ParentId = ParentInfoPtr->parentId;
-                }
-                else
-                {
-                    HOUDINI_LOG_ERROR( TEXT( "Could not find parent of parameter %d" ), ParmInfo.id );
-                    SkipParm = true;
-                }
-            }
-
-            if( SkipParm )
+            // If parameter is invisible, or any parent folder of this parameter is invisible, skip it.
+            if( HiddenParameters[ ParamIdx ] )
                 continue;
 
             UHoudiniAssetParameter * HoudiniAssetParameter = nullptr;
@@ -140,7 +126,7 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
             // We can't use HAPI_ParmId because that is not unique to parameter instances, so instead
             // we find the existing parameter by name
             FString NewParmName;
-            FHoudiniEngineString( ParmInfo.nameSH ).ToFString( NewParmName );
+            FHoudiniParamUtils::ToFString( ParmInfo.nameSH, NewParmName );
             UHoudiniAssetParameter ** FoundHoudiniAssetParameter = CurrentParametersByName.Find( NewParmName );
 
             // If parameter exists, we can reuse it.
@@ -375,6 +361,9 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
             }
         }
 
+        // Values may be uploaded from here on, so the snapshot can no longer be trusted.
+        ValuesSnapshot.Reset();
+
         // We a pass over the new params to patch parent links.
         for( int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx )
         {
@@ -441,3 +430,503 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
 }
 
 
+
+void
+FHoudiniParamUtils::ComputeHiddenParameters(
+    const TArray< HAPI_ParmInfo > & ParmInfos, TMap< HAPI_ParmId, int32 > & ParmIdToIndex,
+    TBitArray<> & HiddenParameters )
+{
+    const int32 ParmCount = ParmInfos.Num();
+
+    ParmIdToIndex.Empty( ParmCount );
+    for( int32 ParamIdx = 0; ParamIdx < ParmCount; ++ParamIdx )
+        ParmIdToIndex.Add( ParmInfos[ ParamIdx ].id, ParamIdx );
+
+    // Returns the index of the parent, INDEX_NONE for top level parameters, or sets bMissing if the parent is unknown.
+    auto GetParentIndex = [ & ]( int32 ParamIdx, bool & bMissing )
+    {
+        bMissing = false;
+        const HAPI_ParmId ParentId = ParmInfos[ ParamIdx ].parentId;
+        if( ParentId <= 0 )
+            return (int32) INDEX_NONE;
+
+        const int32 * FoundIndex = ParmIdToIndex.Find( ParentId );
+        if( !FoundIndex )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Could not find parent of parameter %d" ), ParmInfos[ ParamIdx ].id );
+            bMissing = true;
+            return (int32) INDEX_NONE;
+        }
+
+        return *FoundIndex;
+    };
+
+    // Whether the children of each parameter are hidden, memoized so every ancestor is resolved once.
+    enum EChildrenState : uint8 { Unresolved, Shown, Hidden, Resolving };
+    TArray< uint8 > ChildrenStates;
+    ChildrenStates.SetNumZeroed( ParmCount );
+
+    TArray< int32 > Stack;
+    auto AreChildrenHidden = [ & ]( int32 StartIdx )
+    {
+        Stack.Reset();
+        Stack.Push( StartIdx );
+        while( Stack.Num() > 0 )
+        {
+            const int32 ParamIdx = Stack.Last();
+            if( ChildrenStates[ ParamIdx ] == Shown || ChildrenStates[ ParamIdx ] == Hidden )
+            {
+                Stack.Pop( false );
+                continue;
+            }
+
+            const HAPI_ParmInfo & ParmInfo = ParmInfos[ ParamIdx ];
+            bool bMissingParent = false;
+            const int32 ParentIdx = GetParentIndex( ParamIdx, bMissingParent );
+
+            if( ( ParmInfo.invisible && ParmInfo.type == HAPI_PARMTYPE_FOLDER ) || bMissingParent )
+            {
+                ChildrenStates[ ParamIdx ] = Hidden;
+            }
+            else if( ParentIdx == INDEX_NONE )
+            {
+                ChildrenStates[ ParamIdx ] = Shown;
+            }
+            else if( ChildrenStates[ ParentIdx ] == Unresolved )
+            {
+                // Resolve the parent first, we'll come back to this one.
+                ChildrenStates[ ParamIdx ] = Resolving;
+                Stack.Push( ParentIdx );
+                continue;
+            }
+            else
+            {
+                // A parent still being resolved means the hierarchy loops, treat it as hidden.
+                ChildrenStates[ ParamIdx ] =
+                    ChildrenStates[ ParentIdx ] == Resolving ? (uint8) Hidden : ChildrenStates[ ParentIdx ];
+            }
+
+            Stack.Pop( false );
+        }
+
+        return ChildrenStates[ StartIdx ] == Hidden;
+    };
+
+    HiddenParameters.Init( false, ParmCount );
+    for( int32 ParamIdx = 0; ParamIdx < ParmCount; ++ParamIdx )
+    {
+        if( ParmInfos[ ParamIdx ].invisible )
+        {
+            HiddenParameters[ ParamIdx ] = true;
+            continue;
+        }
+
+        bool bMissingParent = false;
+        const int32 ParentIdx = GetParentIndex( ParamIdx, bMissingParent );
+        HiddenParameters[ ParamIdx ] = bMissingParent || ( ParentIdx != INDEX_NONE && AreChildrenHidden( ParentIdx ) );
+    }
+}
+
+bool
+FHoudiniParamUtils::GetParmIntValues( HAPI_NodeId NodeId, int32 * Values, int32 Start, int32 Count )
+{
+    if ( const FHoudiniParmValuesSnapshot * Snapshot = FHoudiniParmValuesSnapshot::Get( NodeId ) )
+    {
+        if ( Snapshot->GetIntValues( Values, Start, Count ) )
+            return true;
+    }
+
+    return FHoudiniApi::GetParmIntValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::GetParmFloatValues( HAPI_NodeId NodeId, float * Values, int32 Start, int32 Count )
+{
+    if ( const FHoudiniParmValuesSnapshot * Snapshot = FHoudiniParmValuesSnapshot::Get( NodeId ) )
+    {
+        if ( Snapshot->GetFloatValues( Values, Start, Count ) )
+            return true;
+    }
+
+    return FHoudiniApi::GetParmFloatValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::GetParmStringValues( HAPI_NodeId NodeId, FString * Values, int32 Start, int32 Count )
+{
+    if ( const FHoudiniParmValuesSnapshot * Snapshot = FHoudiniParmValuesSnapshot::Get( NodeId ) )
+    {
+        if ( Snapshot->GetStringValues( Values, Start, Count ) )
+            return true;
+    }
+
+    if ( Count <= 0 )
+        return true;
+
+    TArray< HAPI_StringHandle > StringHandles;
+    StringHandles.SetNumZeroed( Count );
+    if ( FHoudiniApi::GetParmStringValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, false,
+        StringHandles.GetData(), Start, Count ) != HAPI_RESULT_SUCCESS )
+    {
+        return false;
+    }
+
+    for ( int32 Idx = 0; Idx < Count; ++Idx )
+        FHoudiniEngineString( StringHandles[ Idx ] ).ToFString( Values[ Idx ] );
+
+    return true;
+}
+
+bool
+FHoudiniParamUtils::GetParmChoiceLists(
+    HAPI_NodeId NodeId, TArray< HAPI_ParmChoiceInfo > & ChoiceInfos, int32 Start, int32 Count )
+{
+    if ( const FHoudiniParmValuesSnapshot * Snapshot = FHoudiniParmValuesSnapshot::Get( NodeId ) )
+    {
+        if ( Snapshot->GetChoiceInfos( ChoiceInfos, Start, Count ) )
+            return true;
+    }
+
+    ChoiceInfos.SetNumUninitialized( Count );
+    for ( int32 Idx = 0; Idx < ChoiceInfos.Num(); Idx++ )
+        FHoudiniApi::ParmChoiceInfo_Init( &( ChoiceInfos[ Idx ] ) );
+
+    if ( Count <= 0 )
+        return true;
+
+    return FHoudiniApi::GetParmChoiceLists(
+        FHoudiniEngine::Get().GetSession(), NodeId, ChoiceInfos.GetData(), Start, Count ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::ToFString( HAPI_StringHandle StringHandle, FString & String )
+{
+    if ( const FHoudiniParmValuesSnapshot * Snapshot = FHoudiniParmValuesSnapshot::GetForString( StringHandle ) )
+        return Snapshot->GetString( StringHandle, String );
+
+    return FHoudiniEngineString( StringHandle ).ToFString( String );
+}
+
+bool
+FHoudiniParamUtils::SetParmIntValues( HAPI_NodeId NodeId, const int32 * Values, int32 Start, int32 Count )
+{
+    if ( FHoudiniParmValuesUpload * ValuesUpload = FHoudiniParmValuesUpload::Get( NodeId ) )
+    {
+        ValuesUpload->AddIntValues( Values, Start, Count );
+        return true;
+    }
+
+    return FHoudiniApi::SetParmIntValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+}
+
+bool
+FHoudiniParamUtils::SetParmFloatValues( HAPI_NodeId NodeId, const float * Values, int32 Start, int32 Count )
+{
+    if ( FHoudiniParmValuesUpload * ValuesUpload = FHoudiniParmValuesUpload::Get( NodeId ) )
+    {
+        ValuesUpload->AddFloatValues( Values, Start, Count );
+        return true;
+    }
+
+    return FHoudiniApi::SetParmFloatValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+}
+
+FHoudiniParmValuesSnapshot * FHoudiniParmValuesSnapshot::CurrentSnapshot = nullptr;
+
+FHoudiniParmValuesSnapshot::FHoudiniParmValuesSnapshot(
+    HAPI_NodeId InNodeId, const HAPI_NodeInfo & NodeInfo, const TArray< HAPI_ParmInfo > & ParmInfos )
+    : NodeId( InNodeId )
+    , bIntValuesValid( false )
+    , bFloatValuesValid( false )
+    , bStringValuesValid( false )
+    , bChoiceInfosValid( false )
+    , PreviousSnapshot( nullptr )
+{
+    if ( !IsInGameThread() )
+        return;
+
+    PreviousSnapshot = CurrentSnapshot;
+    CurrentSnapshot = this;
+
+    // One request per value type for the whole node.
+    IntValues.SetNumZeroed( NodeInfo.parmIntValueCount );
+    bIntValuesValid = IntValues.Num() <= 0 || FHoudiniApi::GetParmIntValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, IntValues.GetData(),
+        0, IntValues.Num() ) == HAPI_RESULT_SUCCESS;
+
+    FloatValues.SetNumZeroed( NodeInfo.parmFloatValueCount );
+    bFloatValuesValid = FloatValues.Num() <= 0 || FHoudiniApi::GetParmFloatValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, FloatValues.GetData(),
+        0, FloatValues.Num() ) == HAPI_RESULT_SUCCESS;
+
+    StringValues.SetNumZeroed( NodeInfo.parmStringValueCount );
+    bStringValuesValid = StringValues.Num() <= 0 || FHoudiniApi::GetParmStringValues(
+        FHoudiniEngine::Get().GetSession(), NodeId, false, StringValues.GetData(),
+        0, StringValues.Num() ) == HAPI_RESULT_SUCCESS;
+
+    ChoiceInfos.SetNumUninitialized( NodeInfo.parmChoiceCount );
+    for ( int32 Idx = 0; Idx < ChoiceInfos.Num(); Idx++ )
+        FHoudiniApi::ParmChoiceInfo_Init( &( ChoiceInfos[ Idx ] ) );
+    bChoiceInfosValid = ChoiceInfos.Num() <= 0 || FHoudiniApi::GetParmChoiceLists(
+        FHoudiniEngine::Get().GetSession(), NodeId, ChoiceInfos.GetData(),
+        0, ChoiceInfos.Num() ) == HAPI_RESULT_SUCCESS;
+
+    // Gather every string handle the parameters will need and resolve them all at once.
+    TArray< HAPI_StringHandle > StringHandles;
+    StringHandles.Reserve( ParmInfos.Num() * 3 + StringValues.Num() + ChoiceInfos.Num() * 2 );
+    TSet< HAPI_StringHandle > UniqueHandles;
+    UniqueHandles.Reserve( StringHandles.Max() );
+    auto AddHandle = [ & ]( HAPI_StringHandle StringHandle )
+    {
+        bool bAlreadyInSet = false;
+        if ( StringHandle >= 0 )
+        {
+            UniqueHandles.Add( StringHandle, &bAlreadyInSet );
+            if ( !bAlreadyInSet )
+                StringHandles.Add( StringHandle );
+        }
+    };
+
+    for ( const HAPI_ParmInfo & ParmInfo : ParmInfos )
+    {
+        AddHandle( ParmInfo.nameSH );
+        AddHandle( ParmInfo.labelSH );
+        AddHandle( ParmInfo.helpSH );
+        AddHandle( ParmInfo.typeInfoSH );
+    }
+
+    if ( bStringValuesValid )
+    {
+        for ( HAPI_StringHandle StringHandle : StringValues )
+            AddHandle( StringHandle );
+    }
+
+    if ( bChoiceInfosValid )
+    {
+        for ( const HAPI_ParmChoiceInfo & ChoiceInfo : ChoiceInfos )
+        {
+            AddHandle( ChoiceInfo.valueSH );
+            AddHandle( ChoiceInfo.labelSH );
+        }
+    }
+
+    TArray< FString > ResolvedStrings;
+    if ( FHoudiniEngineString::ToFStringBatch( StringHandles, ResolvedStrings ) )
+    {
+        Strings.Reserve( StringHandles.Num() );
+        for ( int32 Idx = 0; Idx < StringHandles.Num(); ++Idx )
+            Strings.Add( StringHandles[ Idx ], MoveTemp( ResolvedStrings[ Idx ] ) );
+    }
+    else
+    {
+        // Strings will be resolved one by one.
+        bStringValuesValid = false;
+        bChoiceInfosValid = false;
+    }
+}
+
+FHoudiniParmValuesSnapshot::~FHoudiniParmValuesSnapshot()
+{
+    if ( CurrentSnapshot == this )
+        CurrentSnapshot = PreviousSnapshot;
+}
+
+const FHoudiniParmValuesSnapshot *
+FHoudiniParmValuesSnapshot::Get( HAPI_NodeId InNodeId )
+{
+    if ( !IsInGameThread() )
+        return nullptr;
+
+    for ( const FHoudiniParmValuesSnapshot * Snapshot = CurrentSnapshot; Snapshot; Snapshot = Snapshot->PreviousSnapshot )
+    {
+        if ( Snapshot->NodeId == InNodeId )
+            return Snapshot;
+    }
+
+    return nullptr;
+}
+
+const FHoudiniParmValuesSnapshot *
+FHoudiniParmValuesSnapshot::GetForString( HAPI_StringHandle StringHandle )
+{
+    if ( !IsInGameThread() )
+        return nullptr;
+
+    for ( const FHoudiniParmValuesSnapshot * Snapshot = CurrentSnapshot; Snapshot; Snapshot = Snapshot->PreviousSnapshot )
+    {
+        if ( Snapshot->Strings.Contains( StringHandle ) )
+            return Snapshot;
+    }
+
+    return nullptr;
+}
+
+bool
+FHoudiniParmValuesSnapshot::GetIntValues( int32 * Values, int32 Start, int32 Count ) const
+{
+    if ( !bIntValuesValid || Start < 0 || Count < 0 || Start + Count > IntValues.Num() )
+        return false;
+
+    FMemory::Memcpy( Values, IntValues.GetData() + Start, Count * sizeof( int32 ) );
+    return true;
+}
+
+bool
+FHoudiniParmValuesSnapshot::GetFloatValues( float * Values, int32 Start, int32 Count ) const
+{
+    if ( !bFloatValuesValid || Start < 0 || Count < 0 || Start + Count > FloatValues.Num() )
+        return false;
+
+    FMemory::Memcpy( Values, FloatValues.GetData() + Start, Count * sizeof( float ) );
+    return true;
+}
+
+bool
+FHoudiniParmValuesSnapshot::GetStringValues( FString * Values, int32 Start, int32 Count ) const
+{
+    if ( !bStringValuesValid || Start < 0 || Count < 0 || Start + Count > StringValues.Num() )
+        return false;
+
+    for ( int32 Idx = 0; Idx < Count; ++Idx )
+    {
+        if ( !GetString( StringValues[ Start + Idx ], Values[ Idx ] ) )
+            return false;
+    }
+
+    return true;
+}
+
+bool
+FHoudiniParmValuesSnapshot::GetChoiceInfos(
+    TArray< HAPI_ParmChoiceInfo > & OutChoiceInfos, int32 Start, int32 Count ) const
+{
+    if ( !bChoiceInfosValid || Start < 0 || Count < 0 || Start + Count > ChoiceInfos.Num() )
+        return false;
+
+    OutChoiceInfos.SetNumUninitialized( Count );
+    if ( Count > 0 )
+        FMemory::Memcpy( OutChoiceInfos.GetData(), ChoiceInfos.GetData() + Start, Count * sizeof( HAPI_ParmChoiceInfo ) );
+
+    return true;
+}
+
+bool
+FHoudiniParmValuesSnapshot::GetString( HAPI_StringHandle StringHandle, FString & String ) const
+{
+    const FString * FoundString = Strings.Find( StringHandle );
+    if ( !FoundString )
+        return false;
+
+    String = *FoundString;
+    return true;
+}
+
+FHoudiniParmValuesUpload * FHoudiniParmValuesUpload::CurrentUpload = nullptr;
+
+FHoudiniParmValuesUpload::FHoudiniParmValuesUpload( HAPI_NodeId InNodeId )
+    : NodeId( InNodeId )
+    , PreviousUpload( nullptr )
+{
+    if ( !IsInGameThread() )
+        return;
+
+    PreviousUpload = CurrentUpload;
+    CurrentUpload = this;
+}
+
+FHoudiniParmValuesUpload::~FHoudiniParmValuesUpload()
+{
+    Flush();
+
+    if ( CurrentUpload == this )
+        CurrentUpload = PreviousUpload;
+}
+
+FHoudiniParmValuesUpload *
+FHoudiniParmValuesUpload::Get( HAPI_NodeId InNodeId )
+{
+    if ( !IsInGameThread() )
+        return nullptr;
+
+    for ( FHoudiniParmValuesUpload * Upload = CurrentUpload; Upload; Upload = Upload->PreviousUpload )
+    {
+        if ( Upload->NodeId == InNodeId )
+            return Upload;
+    }
+
+    return nullptr;
+}
+
+void
+FHoudiniParmValuesUpload::AddIntValues( const int32 * Values, int32 Start, int32 Count )
+{
+    for ( int32 Idx = 0; Idx < Count; ++Idx )
+        IntValues.Add( Start + Idx, Values[ Idx ] );
+}
+
+void
+FHoudiniParmValuesUpload::AddFloatValues( const float * Values, int32 Start, int32 Count )
+{
+    for ( int32 Idx = 0; Idx < Count; ++Idx )
+        FloatValues.Add( Start + Idx, Values[ Idx ] );
+}
+
+/** Send queued values as contiguous ranges, one SetFunction call per range. **/
+template< typename ValueType, typename SetFunctionType >
+static bool
+FlushParmValueRanges( TMap< int32, ValueType > & QueuedValues, SetFunctionType SetFunction )
+{
+    if ( QueuedValues.Num() <= 0 )
+        return true;
+
+    QueuedValues.KeySort( TLess< int32 >() );
+
+    bool bSuccess = true;
+    TArray< ValueType > RangeValues;
+    RangeValues.Reserve( QueuedValues.Num() );
+    int32 RangeStart = INDEX_NONE;
+
+    for ( const auto & QueuedValue : QueuedValues )
+    {
+        if ( RangeValues.Num() > 0 && QueuedValue.Key != RangeStart + RangeValues.Num() )
+        {
+            bSuccess &= SetFunction( RangeValues.GetData(), RangeStart, RangeValues.Num() );
+            RangeValues.Reset();
+        }
+
+        if ( RangeValues.Num() <= 0 )
+            RangeStart = QueuedValue.Key;
+
+        RangeValues.Add( QueuedValue.Value );
+    }
+
+    bSuccess &= SetFunction( RangeValues.GetData(), RangeStart, RangeValues.Num() );
+    QueuedValues.Empty();
+
+    return bSuccess;
+}
+
+bool
+FHoudiniParmValuesUpload::Flush()
+{
+    const HAPI_NodeId UploadNodeId = NodeId;
+
+    bool bSuccess = FlushParmValueRanges( IntValues, [ UploadNodeId ]( const int32 * Values, int32 Start, int32 Count )
+    {
+        return FHoudiniApi::SetParmIntValues(
+            FHoudiniEngine::Get().GetSession(), UploadNodeId, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+    } );
+
+    bSuccess &= FlushParmValueRanges( FloatValues, [ UploadNodeId ]( const float * Values, int32 Start, int32 Count )
+    {
+        return FHoudiniApi::SetParmFloatValues(
+            FHoudiniEngine::Get().GetSession(), UploadNodeId, Values, Start, Count ) == HAPI_RESULT_SUCCESS;
+    } );
+
+    return bSuccess;
+}
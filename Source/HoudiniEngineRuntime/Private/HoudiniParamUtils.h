@@ -25,6 +25,8 @@
 
 #include "HAPI_Common.h"
 #include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "Containers/BitArray.h"
 
 struct HOUDINIENGINERUNTIME_API FHoudiniParamUtils
 {
@@ -41,4 +43,120 @@ struct HOUDINIENGINERUNTIME_API FHoudiniParamUtils
     static bool Build( HAPI_NodeId AssetId, class UObject* PrimaryObject, 
         TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& CurrentParameters,
         TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& NewParameters );
+
+    /** Work out, in a single pass over ParmInfos, which parameters should not be created: invisible ones, those
+        below an invisible folder and those whose parent is missing. Also fills the parm id to index lookup. **/
+    static void ComputeHiddenParameters(
+        const TArray< HAPI_ParmInfo > & ParmInfos, TMap< HAPI_ParmId, int32 > & ParmIdToIndex,
+        TBitArray<> & HiddenParameters );
+
+    /** Parameter value accessors used by parameters when (re)creating themselves. These read from the active
+        FHoudiniParmValuesSnapshot of the node when there is one, and query HAPI directly otherwise. **/
+    static bool GetParmIntValues( HAPI_NodeId NodeId, int32 * Values, int32 Start, int32 Count );
+    static bool GetParmFloatValues( HAPI_NodeId NodeId, float * Values, int32 Start, int32 Count );
+    static bool GetParmStringValues( HAPI_NodeId NodeId, FString * Values, int32 Start, int32 Count );
+    static bool GetParmChoiceLists(
+        HAPI_NodeId NodeId, TArray< HAPI_ParmChoiceInfo > & ChoiceInfos, int32 Start, int32 Count );
+
+    /** Resolve a string handle, using the strings of the active snapshots when possible. **/
+    static bool ToFString( HAPI_StringHandle StringHandle, FString & String );
+
+    /** Parameter value setters used when uploading parameters. These queue the values into the active
+        FHoudiniParmValuesUpload of the node when there is one, and set them directly otherwise. **/
+    static bool SetParmIntValues( HAPI_NodeId NodeId, const int32 * Values, int32 Start, int32 Count );
+    static bool SetParmFloatValues( HAPI_NodeId NodeId, const float * Values, int32 Start, int32 Count );
+};
+
+/** Node-wide parameter values, fetched in a few bulk calls while Build (re)creates the parameters of a node.
+    Parameters index into it with the value indices of their HAPI_ParmInfo, instead of issuing one request each. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniParmValuesSnapshot
+{
+    public:
+
+        /** Fetch all values of the node and make this snapshot active for the current scope. **/
+        FHoudiniParmValuesSnapshot(
+            HAPI_NodeId InNodeId, const HAPI_NodeInfo & NodeInfo, const TArray< HAPI_ParmInfo > & ParmInfos );
+        ~FHoudiniParmValuesSnapshot();
+
+        /** Return the active snapshot for the given node, or null. Only available on the game thread. **/
+        static const FHoudiniParmValuesSnapshot * Get( HAPI_NodeId InNodeId );
+
+        /** Return the active snapshot holding the given string handle, or null. **/
+        static const FHoudiniParmValuesSnapshot * GetForString( HAPI_StringHandle StringHandle );
+
+    public:
+
+        bool GetIntValues( int32 * Values, int32 Start, int32 Count ) const;
+        bool GetFloatValues( float * Values, int32 Start, int32 Count ) const;
+        bool GetStringValues( FString * Values, int32 Start, int32 Count ) const;
+        bool GetChoiceInfos( TArray< HAPI_ParmChoiceInfo > & OutChoiceInfos, int32 Start, int32 Count ) const;
+        bool GetString( HAPI_StringHandle StringHandle, FString & String ) const;
+
+    private:
+
+        FHoudiniParmValuesSnapshot( const FHoudiniParmValuesSnapshot & ) = delete;
+        FHoudiniParmValuesSnapshot & operator=( const FHoudiniParmValuesSnapshot & ) = delete;
+
+        /** Node the values were fetched from. **/
+        HAPI_NodeId NodeId;
+
+        /** Node-wide value arrays, indexed by the parm infos value indices. Invalid if the fetch failed. **/
+        TArray< int32 > IntValues;
+        TArray< float > FloatValues;
+        TArray< HAPI_StringHandle > StringValues;
+        TArray< HAPI_ParmChoiceInfo > ChoiceInfos;
+        bool bIntValuesValid;
+        bool bFloatValuesValid;
+        bool bStringValuesValid;
+        bool bChoiceInfosValid;
+
+        /** Resolved strings for value, name, label, help and choice handles. **/
+        TMap< HAPI_StringHandle, FString > Strings;
+
+        /** Snapshot that was active before this one. **/
+        FHoudiniParmValuesSnapshot * PreviousSnapshot;
+
+        static FHoudiniParmValuesSnapshot * CurrentSnapshot;
+};
+
+/** Parameter values queued while uploading changed parameters of a node. On flush, values are sorted by
+    their index in the node-wide value arrays and sent as contiguous ranges, with one request per range. **/
+struct HOUDINIENGINERUNTIME_API FHoudiniParmValuesUpload
+{
+    public:
+
+        /** Make this upload active for the node for the current scope. **/
+        FHoudiniParmValuesUpload( HAPI_NodeId InNodeId );
+
+        /** Flushes any remaining values. **/
+        ~FHoudiniParmValuesUpload();
+
+        /** Return the active upload for the given node, or null. Only available on the game thread. **/
+        static FHoudiniParmValuesUpload * Get( HAPI_NodeId InNodeId );
+
+    public:
+
+        /** Queue values, later values override earlier ones at the same index. **/
+        void AddIntValues( const int32 * Values, int32 Start, int32 Count );
+        void AddFloatValues( const float * Values, int32 Start, int32 Count );
+
+        /** Send all queued values. Returns false if any of the requests failed. **/
+        bool Flush();
+
+    private:
+
+        FHoudiniParmValuesUpload( const FHoudiniParmValuesUpload & ) = delete;
+        FHoudiniParmValuesUpload & operator=( const FHoudiniParmValuesUpload & ) = delete;
+
+        /** Node the values are uploaded to. **/
+        HAPI_NodeId NodeId;
+
+        /** Queued values, keyed by value index. **/
+        TMap< int32, int32 > IntValues;
+        TMap< int32, float > FloatValues;
+
+        /** Upload that was active before this one. **/
+        FHoudiniParmValuesUpload * PreviousUpload;
+
+        static FHoudiniParmValuesUpload * CurrentUpload;
 };
@@ -28,6 +28,12 @@
 #include "HoudiniEngineUtils.h"
 
 #include "Internationalization/Internationalization.h"
+
+#if WITH_EDITOR
+    #include "MeshDescription.h"
+    #include "StaticMeshAttributes.h"
+#endif
+
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
 UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & ObjectInitializer )
@@ -58,6 +64,10 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     bTransformChangeTriggersCooks = false;
     bDisplaySlateCookingNotifications = true;
     bCookCurvesOnMouseRelease = false;
+    bPreviewCurvesWhileDragging = false;
+    CurvePreviewCookInterval = 0.25f;
+    bDeferTemporaryTextureCompression = false;
+    bSaveBakedPackages = false;
 
     TemporaryCookFolder = LOCTEXT("Temp", "/Game/HoudiniEngine/Temp");
 
@@ -82,6 +92,8 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     MarshallingAttributeInputMeshName = TEXT( HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME );
     MarshallingAttributeInputSourceFile = TEXT( HAPI_UNREAL_ATTRIB_INPUT_SOURCE_FILE );
     MarshallingSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
+    MarshallingSplineMaxError = HAPI_UNREAL_PARAM_SPLINE_MAX_ERROR_DEFAULT;
+    MarshallingSkeletonAsGeometry = false;
     MarshallingLandscapesUseDefaultUnrealScaling = false;
     MarshallingLandscapesUseFullResolution = true;
     MarshallingLandscapesForceMinMaxValues = false;
@@ -277,6 +289,8 @@ UHoudiniRuntimeSettings::PostEditChangeProperty( struct FPropertyChangedEvent &
     }
     else if (Property->GetName() == TEXT("MarshallingSplineResolution"))
         MarshallingSplineResolution = FMath::Clamp(MarshallingSplineResolution, 0.0f, 10000.0f);
+    else if (Property->GetName() == TEXT("MarshallingSplineMaxError"))
+        MarshallingSplineMaxError = FMath::Max(MarshallingSplineMaxError, 0.0f);
 
     if ( Property->GetName() == TEXT( "MarshallingLandscapesForceMinMaxValues" ) )
     {
@@ -342,8 +356,23 @@ UHoudiniRuntimeSettings::PostEditChangeProperty( struct FPropertyChangedEvent &
 }
 
 void
-UHoudiniRuntimeSettings::SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSettings, FRawMesh & RawMesh ) const
+UHoudiniRuntimeSettings::SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSettings, const FMeshDescription & MeshDescription ) const
 {
+    // Vertex instance normals and tangents are always registered, unset ones are left zero.
+    FStaticMeshConstAttributes MeshAttributes( MeshDescription );
+    TVertexInstanceAttributesConstRef< FVector > VertexInstanceNormals = MeshAttributes.GetVertexInstanceNormals();
+    TVertexInstanceAttributesConstRef< FVector > VertexInstanceTangents = MeshAttributes.GetVertexInstanceTangents();
+
+    bool bHasNormals = false;
+    bool bHasTangents = false;
+    for ( const FVertexInstanceID VertexInstanceID : MeshDescription.VertexInstances().GetElementIDs() )
+    {
+        bHasNormals |= !VertexInstanceNormals[ VertexInstanceID ].IsNearlyZero();
+        bHasTangents |= !VertexInstanceTangents[ VertexInstanceID ].IsNearlyZero();
+        if ( bHasNormals && bHasTangents )
+            break;
+    }
+
     MeshBuildSettings.bRemoveDegenerates = bRemoveDegenerates;
     MeshBuildSettings.bUseMikkTSpace = bUseMikkTSpace;
     MeshBuildSettings.bBuildAdjacencyBuffer = bBuildAdjacencyBuffer;
@@ -363,7 +392,7 @@ UHoudiniRuntimeSettings::SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSet
 
         case HRSRF_OnlyIfMissing:
         {
-            MeshBuildSettings.bRecomputeNormals = ( 0 == RawMesh.WedgeTangentZ.Num() );
+            MeshBuildSettings.bRecomputeNormals = !bHasNormals;
             break;
         }
 
@@ -386,7 +415,7 @@ UHoudiniRuntimeSettings::SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSet
 
         case HRSRF_OnlyIfMissing:
         {
-            MeshBuildSettings.bRecomputeTangents = ( 0 == RawMesh.WedgeTangentX.Num() || 0 == RawMesh.WedgeTangentY.Num() );
+            MeshBuildSettings.bRecomputeTangents = !bHasTangents;
             break;
         }
 
@@ -399,7 +428,7 @@ UHoudiniRuntimeSettings::SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSet
     }
 
     // Lightmap UV generation.
-    bool bHasLightmapUVSet = FHoudiniEngineUtils::CountUVSets( RawMesh ) > 1;
+    bool bHasLightmapUVSet = MeshAttributes.GetVertexInstanceUVs().GetNumIndices() > 1;
 
     switch ( GenerateLightmapUVsFlag )
     {
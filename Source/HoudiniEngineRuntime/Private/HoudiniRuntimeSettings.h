@@ -28,7 +28,7 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "HoudiniRuntimeSettings.generated.h"
 
-struct FRawMesh;
+struct FMeshDescription;
 class UAssetUserData;
 class UPhysicalMaterial;
 struct FMeshBuildSettings;
@@ -175,7 +175,7 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
 #if WITH_EDITOR
 
         /** Fill static mesh build settings structure based on assigned settings. **/
-        void SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSettings, FRawMesh & RawMesh ) const;
+        void SetMeshBuildSettings( FMeshBuildSettings & MeshBuildSettings, const FMeshDescription & MeshDescription ) const;
 
 #endif // WITH_EDITOR
 
@@ -242,6 +242,25 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
         bool bCookCurvesOnMouseRelease;
 
+        // When curves only cook on mouse release, still cook previews while dragging curve points. Only the latest
+        // points are cooked, and the asset's unreal_curve_preview parameter is enabled for these cooks if it has one.
+        UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = ( EditCondition = "bCookCurvesOnMouseRelease" ))
+        bool bPreviewCurvesWhileDragging;
+
+        // Minimum delay, in seconds, between two curve preview cooks.
+        UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = ( EditCondition = "bPreviewCurvesWhileDragging", ClampMin = "0.0" ))
+        float CurvePreviewCookInterval;
+
+        // Temporary cook textures are created without mipmaps and uncompressed, their full build is deferred
+        // until cooking has been idle for a while. Baked textures are always fully built and compressed.
+        UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
+        bool bDeferTemporaryTextureCompression;
+
+        // Save the packages created by a bake once it is done, together and with asynchronous file writes,
+        // instead of leaving them dirty. Off by default, baked packages are left dirty for the user to save.
+        UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
+        bool bSaveBakedPackages;
+
         // Content folder storing all the temporary cook data
         UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
         FText TemporaryCookFolder;
@@ -321,6 +340,17 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
         float MarshallingSplineResolution;
 
+        // Maximum distance (in cm) between the marshalled Unreal Splines and the original ones. Curved segments
+        // are sampled more densely than straight ones, down to the spline resolution. 0, the default, samples at a fixed step.
+        UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling, meta = (ClampMin = "0.0"))
+        float MarshallingSplineMaxError;
+
+        // If true, the skeletons of skeletal mesh inputs are marshalled as a single SOP, with a point per bone and a
+        // line from each bone to its parent, instead of as an objnet containing a null and a bone node per bone.
+        // Off by default, as existing assets expect the objnet.
+        UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
+        bool MarshallingSkeletonAsGeometry;
+
         // If true, generated Landscapes will be marshalled using default unreal scaling. 
         // Generated landscape will loose a lot of precision on the Z axis but will use the same transforms
         // as Unreal's default landscape
@@ -372,6 +372,22 @@ UHoudiniSplineComponent::IsInputCurve() const
     return ( HoudiniAssetInput && !HoudiniAssetInput->IsPendingKill() );
 }
 
+UHoudiniAssetComponent *
+UHoudiniSplineComponent::GetCookedHoudiniAssetComponent() const
+{
+    // Input curves are cooked by the asset owning the input, other curves by the asset they are attached to.
+    UHoudiniAssetComponent * HoudiniAssetComponent = nullptr;
+    if ( IsInputCurve() )
+        HoudiniAssetComponent = HoudiniAssetInput->GetHoudiniAssetComponent();
+    else
+        HoudiniAssetComponent = Cast< UHoudiniAssetComponent >( GetAttachParent() );
+
+    if ( !HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill() )
+        return nullptr;
+
+    return HoudiniAssetComponent;
+}
+
 void
 UHoudiniSplineComponent::SetHoudiniAssetInput( UHoudiniAssetInput * InHoudiniAssetInput )
 {
@@ -154,6 +154,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniSplineComponent : public USceneComponent
         /** Return true if this is an input curve. **/
         bool IsInputCurve() const;
 
+        /** Return the Houdini asset component cooked when this curve changes. **/
+        class UHoudiniAssetComponent * GetCookedHoudiniAssetComponent() const;
+
         /** Returns true if this Spline component is Active **/
         bool IsActive() const;
 
@@ -7,6 +7,9 @@
 #include "Misc/AutomationTest.h"
 #include "FileCacheUtilities.h"
 #include "StaticMeshResources.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "Rendering/SkeletalMeshLODModel.h"
 #include "LevelEditorViewport.h"
 #include "AssetRegistryModule.h"
 #include "PropertyEditorModule.h"
@@ -14,8 +17,11 @@
 #include "IDetailsView.h"
 
 #include "HoudiniEngine.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineBakeUtils.h"
+#include "HoudiniEngineMaterialUtils.h"
 #include "HoudiniParamUtils.h"
 #include "HoudiniCookHandler.h"
 #include "HoudiniRuntimeSettings.h"
@@ -33,6 +39,13 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeUploadStaticMeshTest, "Ho
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeActorTest, "Houdini.Runtime.ActorTest", kTestFlags )
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeParamTest, "Houdini.Runtime.ParamTest", kTestFlags )
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeBatchTest, "Houdini.Runtime.BatchTest", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeTextureConversionTest, "Houdini.Runtime.TextureConversion", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeTextureConversionBenchmark, "Houdini.Runtime.TextureConversionBenchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeParamHierarchyTest, "Houdini.Runtime.ParamHierarchy", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeSkinWeightsTest, "Houdini.Runtime.SkinWeights", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeBakeContentHashTest, "Houdini.Runtime.BakeContentHash", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeInputCurveTest, "Houdini.Runtime.InputCurve", kTestFlags )
 
 static float TestTickDelay = 1.0f;
 
@@ -760,4 +773,401 @@ bool FHoudiniEngineRuntimeMeshMarshalTest::RunTest( const FString& Parameters )
     return true;
 }
 
+bool FHoudiniEngineRuntimeTextureConversionTest::RunTest( const FString& Parameters )
+{
+    // 2x2 RGBA image, only the first pixel is translucent.
+    const uint8 Src[ 16 ] = {
+        1, 2, 3, 4,       5, 6, 7, 255,
+        9, 10, 11, 255,   13, 14, 15, 255 };
+
+    // Rows are flipped and channels swapped to BGRA.
+    const uint8 ExpectedBGRA[ 16 ] = {
+        11, 10, 9, 255,   15, 14, 13, 255,
+        3, 2, 1, 4,       7, 6, 5, 255 };
+
+    uint8 Result[ 16 ] = { 0 };
+    TestTrue( TEXT( "Alpha detected" ), FHoudiniEngineMaterialUtils::ConvertImageRGBAToBGRA( Src, Result, 2, 2, true ) );
+    TestTrue( TEXT( "BGRA pixels" ), FMemory::Memcmp( Result, ExpectedBGRA, sizeof( Result ) ) == 0 );
+
+    // Without alpha, it is replaced by opaque values.
+    TestFalse( TEXT( "No alpha" ), FHoudiniEngineMaterialUtils::ConvertImageRGBAToBGRA( Src, Result, 2, 2, false ) );
+    TestEqual( TEXT( "Opaque alpha" ), (int32) Result[ 11 ], 255 );
+    TestEqual( TEXT( "Swapped channels" ), (int32) Result[ 8 ], 3 );
+
+    // 7x2 image: the first four pixels of each row go through the vectorized loop, the last three through the
+    // scalar tail. A translucent pixel is placed in each part in turn.
+    const int32 Width = 7;
+    const int32 Height = 2;
+    const int32 TranslucentPixels[] = { 1, 5 };
+    for ( int32 TranslucentPixel : TranslucentPixels )
+    {
+        TArray< uint8 > WideSrc, WideExpected, WideResult;
+        WideSrc.SetNumUninitialized( Width * Height * 4 );
+        WideExpected.SetNumUninitialized( WideSrc.Num() );
+        WideResult.SetNumZeroed( WideSrc.Num() );
+
+        for ( int32 y = 0; y < Height; ++y )
+        {
+            for ( int32 x = 0; x < Width; ++x )
+            {
+                const int32 Pixel = y * Width + x;
+                const uint8 Alpha = ( y == 1 && x == TranslucentPixel ) ? 128 : 255;
+                const uint8 Rgba[ 4 ] = { (uint8) ( Pixel * 4 ), (uint8) ( Pixel * 4 + 1 ), (uint8) ( Pixel * 4 + 2 ), Alpha };
+                FMemory::Memcpy( &WideSrc[ Pixel * 4 ], Rgba, 4 );
+
+                const int32 FlippedPixel = ( Height - 1 - y ) * Width + x;
+                const uint8 Bgra[ 4 ] = { Rgba[ 2 ], Rgba[ 1 ], Rgba[ 0 ], Alpha };
+                FMemory::Memcpy( &WideExpected[ FlippedPixel * 4 ], Bgra, 4 );
+            }
+        }
+
+        TestTrue( FString::Printf( TEXT( "Alpha detected at pixel %d" ), TranslucentPixel ),
+            FHoudiniEngineMaterialUtils::ConvertImageRGBAToBGRA( WideSrc.GetData(), WideResult.GetData(), Width, Height, true ) );
+        TestTrue( FString::Printf( TEXT( "BGRA pixels with alpha at pixel %d" ), TranslucentPixel ),
+            FMemory::Memcmp( WideResult.GetData(), WideExpected.GetData(), WideSrc.Num() ) == 0 );
+    }
+
+    return true;
+}
+
+bool FHoudiniEngineRuntimeTextureConversionBenchmark::RunTest( const FString& Parameters )
+{
+    // Reference conversion, matches the original per byte loop of CreateUnrealTexture.
+    auto ReferenceConvert = []( const TArray< uint8 >& Src, TArray< uint8 >& Dest, int32 Width, int32 Height )
+    {
+        for ( int32 y = 0; y < Height; y++ )
+        {
+            uint8* DestPtr = &Dest[ ( Height - 1 - y ) * Width * 4 ];
+            for ( int32 x = 0; x < Width; x++ )
+            {
+                const int32 Offset = ( y * Width + x ) * 4;
+                *DestPtr++ = Src[ Offset + 2 ];
+                *DestPtr++ = Src[ Offset + 1 ];
+                *DestPtr++ = Src[ Offset + 0 ];
+                *DestPtr++ = Src[ Offset + 3 ];
+            }
+        }
+    };
+
+    FRandomStream RandomStream( 1234 );
+
+    // Timings at usual texture resolutions.
+    for ( int32 Resolution = 1024; Resolution <= 8192; Resolution *= 2 )
+    {
+        TArray< uint8 > Src, Dest, Reference;
+        Src.SetNumUninitialized( Resolution * Resolution * 4 );
+        for ( int32 Idx = 0; Idx < Src.Num(); Idx += 4 )
+            *(uint32*) &Src[ Idx ] = RandomStream.GetUnsignedInt() | 0xFF000000;
+        Dest.SetNumUninitialized( Src.Num() );
+        Reference.SetNumUninitialized( Src.Num() );
+
+        double StartTime = FPlatformTime::Seconds();
+        ReferenceConvert( Src, Reference, Resolution, Resolution );
+        const double ReferenceTime = FPlatformTime::Seconds() - StartTime;
+
+        StartTime = FPlatformTime::Seconds();
+        FHoudiniEngineMaterialUtils::ConvertImageRGBAToBGRA( Src.GetData(), Dest.GetData(), Resolution, Resolution, true );
+        const double ConvertTime = FPlatformTime::Seconds() - StartTime;
+
+        TestTrue( FString::Printf( TEXT( "Pixels match %dx%d" ), Resolution, Resolution ),
+            FMemory::Memcmp( Reference.GetData(), Dest.GetData(), Src.Num() ) == 0 );
+
+        UE_LOG( LogHoudiniTests, Log, TEXT( "Texture conversion %dx%d: reference %.2f ms, converted %.2f ms" ),
+            Resolution, Resolution, ReferenceTime * 1000.0, ConvertTime * 1000.0 );
+    }
+
+    return true;
+}
+
+bool FHoudiniEngineRuntimeParamHierarchyTest::RunTest( const FString& Parameters )
+{
+    // Small hierarchy, parameters don't necessarily come after their parents.
+    auto MakeParmInfo = []( HAPI_ParmId Id, HAPI_ParmId ParentId, HAPI_ParmType Type, bool bInvisible )
+    {
+        HAPI_ParmInfo ParmInfo;
+        FMemory::Memzero( ParmInfo );
+        ParmInfo.id = Id;
+        ParmInfo.parentId = ParentId;
+        ParmInfo.type = Type;
+        ParmInfo.invisible = bInvisible;
+        ParmInfo.size = 1;
+        return ParmInfo;
+    };
+
+    TArray< HAPI_ParmInfo > ParmInfos;
+    ParmInfos.Add( MakeParmInfo( 11, 10, HAPI_PARMTYPE_FLOAT, false ) );
+    ParmInfos.Add( MakeParmInfo( 10, 3, HAPI_PARMTYPE_FOLDER, false ) );
+    ParmInfos.Add( MakeParmInfo( 3, -1, HAPI_PARMTYPE_FOLDER, true ) );
+    ParmInfos.Add( MakeParmInfo( 1, -1, HAPI_PARMTYPE_FOLDER, false ) );
+    ParmInfos.Add( MakeParmInfo( 2, 1, HAPI_PARMTYPE_FLOAT, false ) );
+    ParmInfos.Add( MakeParmInfo( 4, 1, HAPI_PARMTYPE_FLOAT, true ) );
+    ParmInfos.Add( MakeParmInfo( 8, 7, HAPI_PARMTYPE_FLOAT, false ) );
+    ParmInfos.Add( MakeParmInfo( 7, 1, HAPI_PARMTYPE_MULTIPARMLIST, true ) );
+
+    TMap< HAPI_ParmId, int32 > ParmIdToIndex;
+    TBitArray<> HiddenParameters;
+    FHoudiniParamUtils::ComputeHiddenParameters( ParmInfos, ParmIdToIndex, HiddenParameters );
+
+    TestEqual( TEXT( "Id lookup size" ), ParmIdToIndex.Num(), ParmInfos.Num() );
+    TestEqual( TEXT( "Id lookup" ), ParmIdToIndex.FindRef( 7 ), 7 );
+    if( HiddenParameters.Num() != ParmInfos.Num() )
+    {
+        AddError( TEXT( "Unexpected hidden parameters size" ) );
+        return false;
+    }
+
+    // Invisible folders hide all their descendants, other invisible parents don't.
+    TestTrue( TEXT( "Parameter in nested folder of invisible folder is hidden" ), HiddenParameters[ 0 ] );
+    TestTrue( TEXT( "Folder in invisible folder is hidden" ), HiddenParameters[ 1 ] );
+    TestTrue( TEXT( "Invisible folder is hidden" ), HiddenParameters[ 2 ] );
+    TestFalse( TEXT( "Visible folder is shown" ), HiddenParameters[ 3 ] );
+    TestFalse( TEXT( "Parameter in visible folder is shown" ), HiddenParameters[ 4 ] );
+    TestTrue( TEXT( "Invisible parameter is hidden" ), HiddenParameters[ 5 ] );
+    TestFalse( TEXT( "Child of invisible multiparm is shown" ), HiddenParameters[ 6 ] );
+    TestTrue( TEXT( "Invisible multiparm is hidden" ), HiddenParameters[ 7 ] );
+
+    return true;
+}
+
+bool FHoudiniEngineRuntimeSkinWeightsTest::RunTest( const FString& Parameters )
+{
+    // Three sections of one triangle, the middle one disabled like the original of a legacy clothing section.
+    FSkeletalMeshLODModel LODModel;
+    LODModel.NumTexCoords = 1;
+    LODModel.NumVertices = 9;
+    for( int32 SectionIdx = 0; SectionIdx < 3; ++SectionIdx )
+    {
+        FSkelMeshSection& Section = LODModel.Sections.AddDefaulted_GetRef();
+        Section.MaterialIndex = SectionIdx + 1;
+        Section.bDisabled = SectionIdx == 1;
+        Section.BaseVertexIndex = SectionIdx * 3;
+        Section.NumVertices = 3;
+        Section.BaseIndex = SectionIdx * 3;
+        Section.NumTriangles = 1;
+        Section.BoneMap.Add( (FBoneIndexType)( SectionIdx * 10 + 5 ) );
+        Section.BoneMap.Add( (FBoneIndexType)( SectionIdx * 10 + 7 ) );
+
+        Section.SoftVertices.SetNumZeroed( 3 );
+        for( int32 VertexIdx = 0; VertexIdx < 3; ++VertexIdx )
+        {
+            FSoftSkinVertex& SoftVertex = Section.SoftVertices[ VertexIdx ];
+            SoftVertex.Position = FVector( VertexIdx, 10.0f * VertexIdx, 100.0f * SectionIdx );
+            SoftVertex.TangentZ = FVector4( 0.0f, 0.0f, 1.0f, 1.0f );
+            SoftVertex.UVs[ 0 ] = FVector2D( 0.5f, 0.25f );
+            LODModel.IndexBuffer.Add( Section.BaseVertexIndex + VertexIdx );
+        }
+
+        // One influence on the first vertex, two on the second, in sparse slots.
+        Section.SoftVertices[ 0 ].InfluenceBones[ 2 ] = 1;
+        Section.SoftVertices[ 0 ].InfluenceWeights[ 2 ] = 255;
+        Section.SoftVertices[ 1 ].InfluenceBones[ 1 ] = 0;
+        Section.SoftVertices[ 1 ].InfluenceWeights[ 1 ] = 51;
+        Section.SoftVertices[ 1 ].InfluenceBones[ 3 ] = 1;
+        Section.SoftVertices[ 1 ].InfluenceWeights[ 3 ] = 204;
+        Section.SoftVertices[ 2 ].InfluenceBones[ 0 ] = 0;
+        Section.SoftVertices[ 2 ].InfluenceWeights[ 0 ] = 255;
+    }
+
+    FHoudiniSkeletalMeshLODData LODData;
+    const bool bExtracted = FHoudiniEngineUtils::ExtractSkeletalMeshLODData( LODModel, 1.0f, true, LODData );
+    TestTrue( TEXT( "LOD extracted" ), bExtracted );
+    if( !bExtracted )
+        return false;
+
+    // The disabled section is skipped, faces are rewound and Y / Z swapped.
+    TestEqual( TEXT( "Point count" ), LODData.GetPointCount(), 6 );
+    TestTrue( TEXT( "Vertex list" ), LODData.VertexList == TArray< int32 >( { 0, 2, 1, 3, 5, 4 } ) );
+    TestTrue( TEXT( "Face materials" ), LODData.FaceMaterialIds == TArray< int32 >( { 1, 3 } ) );
+    TestEqual( TEXT( "Last point Y" ), LODData.Positions[ 5 * 3 + 1 ], 200.0f );
+    TestEqual( TEXT( "Last point Z" ), LODData.Positions[ 5 * 3 + 2 ], 20.0f );
+    TestEqual( TEXT( "Normal up" ), LODData.Normals[ 1 ], 1.0f );
+    TestEqual( TEXT( "UV sets" ), LODData.UVs.Num(), 1 );
+    TestEqual( TEXT( "UV V flipped" ), LODData.UVs[ 0 ][ 1 ], 0.75f );
+
+    // Weights are packed to the widest vertex, non zero influences first and mapped to the reference skeleton.
+    TestEqual( TEXT( "Influence count" ), LODData.InfluenceCount, 2 );
+    TestTrue( TEXT( "Bone indices" ), LODData.BoneIndices == TArray< int32 >( { 7, -1, 5, 7, 5, -1, 27, -1, 25, 27, 25, -1 } ) );
+    TestEqual( TEXT( "Single weight" ), LODData.BoneWeights[ 0 ], 1.0f );
+    TestEqual( TEXT( "Padded weight" ), LODData.BoneWeights[ 1 ], 0.0f );
+    TestEqual( TEXT( "Split weight" ), LODData.BoneWeights[ 2 ], 0.2f );
+    TestEqual( TEXT( "Split weight" ), LODData.BoneWeights[ 3 ], 0.8f );
+
+    return true;
+}
+
+bool FHoudiniEngineRuntimeBakeContentHashTest::RunTest( const FString& Parameters )
+{
+    // Two copies of a mesh and its body setup, with their own names and guids.
+    auto MakeStaticMesh = []( UMaterialInterface* Material )
+    {
+        UStaticMesh* StaticMesh = NewObject< UStaticMesh >( GetTransientPackage(), NAME_None, RF_Transient );
+        StaticMesh->LightMapResolution = 128;
+        StaticMesh->StaticMaterials.Add( FStaticMaterial( Material, TEXT( "Slot" ) ) );
+        StaticMesh->CreateBodySetup();
+        StaticMesh->BodySetup->CollisionTraceFlag = CTF_UseComplexAsSimple;
+        StaticMesh->LightingGuid = FGuid::NewGuid();
+        return StaticMesh;
+    };
+
+    UMaterial* Material = NewObject< UMaterial >( GetTransientPackage(), NAME_None, RF_Transient );
+    UMaterial* OtherMaterial = NewObject< UMaterial >( GetTransientPackage(), NAME_None, RF_Transient );
+    UStaticMesh* StaticMesh = MakeStaticMesh( Material );
+    UStaticMesh* CopiedStaticMesh = MakeStaticMesh( Material );
+
+    const TMap< FString, FString > NoReplacedPaths;
+    const FString Hash = FHoudiniEngineBakeUtils::ComputeBakeContentHash( StaticMesh, NoReplacedPaths );
+    TestFalse( TEXT( "Hash computed" ), Hash.IsEmpty() );
+    TestEqual( TEXT( "Copies have the same hash" ), FHoudiniEngineBakeUtils::ComputeBakeContentHash( CopiedStaticMesh, NoReplacedPaths ), Hash );
+
+    // A mesh referencing another material matches once that material is replaced by the first one.
+    UStaticMesh* RemappedStaticMesh = MakeStaticMesh( OtherMaterial );
+    TestNotEqual( TEXT( "Other material changes the hash" ), FHoudiniEngineBakeUtils::ComputeBakeContentHash( RemappedStaticMesh, NoReplacedPaths ), Hash );
+
+    TMap< FString, FString > ReplacedPaths;
+    ReplacedPaths.Add( OtherMaterial->GetPathName(), Material->GetPathName() );
+    TestEqual( TEXT( "Replaced material matches" ), FHoudiniEngineBakeUtils::ComputeBakeContentHash( RemappedStaticMesh, ReplacedPaths ), Hash );
+
+    // Properties of the mesh and of its subobjects are part of the hash.
+    CopiedStaticMesh->LightMapResolution = 256;
+    TestNotEqual( TEXT( "Property changes the hash" ), FHoudiniEngineBakeUtils::ComputeBakeContentHash( CopiedStaticMesh, NoReplacedPaths ), Hash );
+    RemappedStaticMesh->BodySetup->CollisionTraceFlag = CTF_UseDefault;
+    TestNotEqual( TEXT( "Subobject property changes the hash" ), FHoudiniEngineBakeUtils::ComputeBakeContentHash( RemappedStaticMesh, ReplacedPaths ), Hash );
+
+    // Two meshes differing only in their geometry: a triangle at a different height.
+    auto CommitTriangle = [ this ]( UStaticMesh* StaticMesh, float Height )
+    {
+        StaticMesh->AddSourceModel();
+
+        FMeshDescription MeshDescription;
+        FStaticMeshAttributes MeshAttributes( MeshDescription );
+        MeshAttributes.Register();
+
+        TVertexAttributesRef< FVector > VertexPositions = MeshAttributes.GetVertexPositions();
+        const FPolygonGroupID PolygonGroupID = MeshDescription.CreatePolygonGroup();
+        TArray< FVertexInstanceID > VertexInstanceIDs;
+        for ( int32 CornerIdx = 0; CornerIdx < 3; ++CornerIdx )
+        {
+            const FVertexID VertexID = MeshDescription.CreateVertex();
+            VertexPositions[ VertexID ] = FVector( CornerIdx == 1 ? 100.0f : 0.0f, CornerIdx == 2 ? 100.0f : 0.0f, Height );
+            VertexInstanceIDs.Add( MeshDescription.CreateVertexInstance( VertexID ) );
+        }
+        MeshDescription.CreatePolygon( PolygonGroupID, VertexInstanceIDs );
+
+        TestTrue( TEXT( "Mesh description committed" ), FHoudiniEngineUtils::CommitMeshDescription( StaticMesh, 0, MoveTemp( MeshDescription ) ) );
+    };
+
+    UStaticMesh* TriangleStaticMesh = MakeStaticMesh( Material );
+    UStaticMesh* RaisedTriangleStaticMesh = MakeStaticMesh( Material );
+    UStaticMesh* CopiedTriangleStaticMesh = MakeStaticMesh( Material );
+    CommitTriangle( TriangleStaticMesh, 0.0f );
+    CommitTriangle( RaisedTriangleStaticMesh, 10.0f );
+    CommitTriangle( CopiedTriangleStaticMesh, 0.0f );
+
+    const FString TriangleHash = FHoudiniEngineBakeUtils::ComputeBakeContentHash( TriangleStaticMesh, NoReplacedPaths );
+    TestNotEqual( TEXT( "Geometry changes the hash" ), TriangleHash, Hash );
+    TestNotEqual( TEXT( "Moved geometry changes the hash" ),
+        FHoudiniEngineBakeUtils::ComputeBakeContentHash( RaisedTriangleStaticMesh, NoReplacedPaths ), TriangleHash );
+    TestEqual( TEXT( "Same geometry has the same hash" ),
+        FHoudiniEngineBakeUtils::ComputeBakeContentHash( CopiedTriangleStaticMesh, NoReplacedPaths ), TriangleHash );
+
+    return true;
+}
+
+bool FHoudiniEngineRuntimeInputCurveTest::RunTest( const FString& Parameters )
+{
+    HelperInstantiateAsset( this, TEXT( "/HoudiniEngine/Test/InputEcho" ),
+        [=]( FHoudiniEngineTaskInfo InstantiateTaskInfo, UHoudiniAsset* HoudiniAsset )
+    {
+        HAPI_NodeId AssetId = InstantiateTaskInfo.AssetId;
+
+        if( AssetId < 0 )
+        {
+            return;
+        }
+
+        float GeoScale = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+        EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+        if( const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >() )
+        {
+            GeoScale = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+            ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+        }
+
+        // CV curves come back from the curve node with the order and closed state set on it, and their CVs unchanged.
+        struct FCurveCase
+        {
+            int32 CurveType;
+            int32 Order;
+            int32 Closed;
+            int32 NumCVs;
+        };
+
+        const FCurveCase CurveCases[] = {
+            { HAPI_CURVETYPE_NURBS, 3, 1, 5 },
+            { HAPI_CURVETYPE_BEZIER, 3, 0, 5 } };
+
+        const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+        for( const FCurveCase& CurveCase : CurveCases )
+        {
+            HAPI_NodeId CurveNodeId = -1;
+            if( !FHoudiniEngineUtils::HapiCreateCurveNode( CurveNodeId ) )
+            {
+                AddError( TEXT( "HapiCreateCurveNode failed" ) );
+                continue;
+            }
+
+            FHoudiniApi::SetParmIntValue( Session, CurveNodeId, HAPI_UNREAL_PARAM_CURVE_TYPE, 0, CurveCase.CurveType );
+            FHoudiniApi::SetParmIntValue( Session, CurveNodeId, HAPI_UNREAL_PARAM_CURVE_ORDER, 0, CurveCase.Order );
+            FHoudiniApi::SetParmIntValue( Session, CurveNodeId, HAPI_UNREAL_PARAM_CURVE_CLOSED, 0, CurveCase.Closed );
+
+            TArray< FVector > Positions;
+            for( int32 Idx = 0; Idx < CurveCase.NumCVs; ++Idx )
+                Positions.Add( FVector( Idx * 100.0f, ( Idx % 2 ) * 50.0f, Idx * 10.0f ) );
+
+            TArray< FVector > UploadedPositions = Positions;
+            TestTrue( TEXT( "Curve uploaded" ),
+                FHoudiniEngineUtils::HapiCreateCurveInputNodeForData( AssetId, CurveNodeId, &UploadedPositions ) );
+            TestEqual( TEXT( "CookNode" ), FHoudiniApi::CookNode( Session, CurveNodeId, nullptr ), HAPI_RESULT_SUCCESS );
+
+            HAPI_CurveInfo CurveInfo;
+            FHoudiniApi::CurveInfo_Init( &CurveInfo );
+            TestEqual( TEXT( "GetCurveInfo" ), FHoudiniApi::GetCurveInfo( Session, CurveNodeId, 0, &CurveInfo ), HAPI_RESULT_SUCCESS );
+            TestEqual( TEXT( "Curve type" ), (int32) CurveInfo.curveType, CurveCase.CurveType );
+            TestEqual( TEXT( "Curve order" ), CurveInfo.order, CurveCase.Order );
+            TestEqual( TEXT( "Curve periodic" ), (int32) CurveInfo.isPeriodic, CurveCase.Closed );
+            TestEqual( TEXT( "Curve CV count" ), CurveInfo.vertexCount, CurveCase.NumCVs );
+
+            HAPI_AttributeInfo AttributeInfo;
+            FHoudiniApi::AttributeInfo_Init( &AttributeInfo );
+            FHoudiniApi::GetAttributeInfo( Session, CurveNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, HAPI_ATTROWNER_POINT, &AttributeInfo );
+            if( AttributeInfo.count != CurveCase.NumCVs || AttributeInfo.tupleSize != 3 )
+            {
+                AddError( TEXT( "Unexpected curve positions" ) );
+            }
+            else
+            {
+                TArray< float > CurvePositions;
+                CurvePositions.SetNumZeroed( AttributeInfo.count * 3 );
+                FHoudiniApi::GetAttributeFloatData(
+                    Session, CurveNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION,
+                    &AttributeInfo, -1, CurvePositions.GetData(), 0, AttributeInfo.count );
+
+                for( int32 Idx = 0; Idx < CurveCase.NumCVs; ++Idx )
+                {
+                    FVector Position( CurvePositions[ Idx * 3 + 0 ], CurvePositions[ Idx * 3 + 1 ], CurvePositions[ Idx * 3 + 2 ] );
+                    if( ImportAxis == HRSAI_Unreal )
+                        Swap( Position.Y, Position.Z );
+
+                    TestTrue( TEXT( "CV position" ), Position.Equals( Positions[ Idx ] / GeoScale, 0.001f ) );
+                }
+            }
+
+            FHoudiniApi::DeleteNode( Session, CurveNodeId );
+        }
+
+        HelperDeleteAsset( this, AssetId );
+    } );
+    return true;
+}
+
 #endif // WITH_EDITOR
\ No newline at end of file
@@ -75,6 +75,8 @@ struct HOUDINIENGINERUNTIME_API FHoudiniCookParams
     TMap<FHoudiniGeoPartObject, TWeakObjectPtr<class UPackage> >* BakedStaticMeshPackagesForParts = nullptr;
     // Transient cache of last baked materials and textures
     TMap<FString, TWeakObjectPtr<class UPackage> >* BakedMaterialPackagesForIds = nullptr;
+    // Transient cache of baked textures, keyed by content hash, shared by all the baked materials
+    TMap<FString, TWeakObjectPtr<class UTexture2D> >* BakedTexturesForHashes = nullptr;
 
     // Cache of the temp cook content packages created by the asset for its materials/textures
     TMap<FHoudiniGeoPartObject, TWeakObjectPtr<class UPackage> >* CookedTemporaryStaticMeshPackages = nullptr;
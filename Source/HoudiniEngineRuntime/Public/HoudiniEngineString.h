@@ -28,6 +28,7 @@ class FString;
 class FName;
 
 #include "CoreTypes.h"
+#include "Containers/Array.h"
 #include <string>
 
 class HOUDINIENGINERUNTIME_API FHoudiniEngineString
@@ -54,6 +55,9 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineString
         bool ToFString( FString & String ) const;
         bool ToFText( FText & Text ) const;
 
+        /** Resolve many string handles with a single batched request. Strings are returned in handle order. **/
+        static bool ToFStringBatch( const TArray< int32 > & InStringIds, TArray< FString > & OutStrings );
+
     public:
 
         /** Return id of this string. **/